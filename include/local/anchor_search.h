@@ -0,0 +1,42 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file anchor_search.h
+ * @see anchor_search.c
+ */
+
+#ifndef __ANCHOR_SEARCH_H__
+#define __ANCHOR_SEARCH_H__
+
+#include <stdbool.h>
+
+#include <local/piece_data.h>      // NB_OF_PIECES, MAX_NB_OF_SIDE_PER_PIECE
+#include <local/board.h>           // Board
+#include <local/parallel_search.h> // SolverResult
+
+/**
+ * @struct AnchorSearchState
+ * Current state of the exploration of 1 combination, with the anchor position strategy (see anchor_search.c)
+ */
+typedef struct AnchorSearchState
+{
+    // ------ Combination data (see search_algorithm.c > "load_combination_data")
+    int piece_idx_priority_array[NB_OF_PIECES];
+    int nb_of_playable_pieces;
+    bool playable_side_per_piece_idx_mask[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE];
+
+    bool is_piece_added_array[NB_OF_PIECES]; // pieces of piece_idx_priority_array that are on the board
+
+    // ------ Cursors of each depth (depth = number of pieces added since the start of the combination)
+    int anchor_bit_idx_array[NB_OF_PIECES];  // first empty position of the board when the depth has been reached
+    int piece_rank_array[NB_OF_PIECES];      // index in piece_idx_priority_array of the piece currently tried at the anchor position
+    int covering_cursor_array[NB_OF_PIECES]; // index in placement_table.covering_placement_idx_array of the next placement to try
+    int added_piece_idx_array[NB_OF_PIECES]; // piece added at each depth
+
+} AnchorSearchState;
+
+SolverResult solve_level_with_anchor_cells(int level_num, Board **solution_board);
+void run_algorithm_with_anchor_cells(int level_num);
+
+#endif
@@ -34,6 +34,34 @@ typedef enum SimpleTileType
 
 } SimpleTileType;
 
-Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos, SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT]);
+/**
+ * @struct OpenSetElement
+ * element of the open set of the pathfinding algorithm (priority queue implemented as a sorted linked list)
+ */
+typedef struct OpenSetElement
+{
+    int f, h;
+    Vector2_int pos;
+
+    struct OpenSetElement *next;
+
+} OpenSetElement;
+
+#define MAX_NB_OF_TILE_TO_EXPLORE BOARD_HEIGHT *BOARD_WIDTH * 10 // assuming the anti-backtrack feature of this algorithm is working, we can only explore each tile 4 times ? + margin to make sure
+// (by doing experiments with the dynamic memory version of this algorithm, I actually found out that it never exceeded BOARD_HEIGHT*BOARD_WIDTH, but BOARD_HEIGHT*BOARD_WIDTH*10 is still a small number, so I'm not taking risks)
+
+/**
+ * @struct AstarMemory
+ * Memory used by "find_a_path", that used to be static variables of the function
+ * one per solver (see solver_context.h), so that multiple solves can run at the same time
+ */
+typedef struct AstarMemory
+{
+    int g_score_matrix[BOARD_WIDTH][BOARD_HEIGHT];
+    OpenSetElement open_set_element_placeholders[MAX_NB_OF_TILE_TO_EXPLORE]; // static memory emplacements instead of malloc calls
+
+} AstarMemory;
+
+Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos, SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT], AstarMemory *astar_memory);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file batch_solver.h
+ * @see batch_solver.c
+ */
+
+#ifndef __BATCH_SOLVER_H__
+#define __BATCH_SOLVER_H__
+
+#include <local/parallel_search.h> // SolverResult
+#include <local/solver_context.h>  // CheckSettings
+
+#define FIRST_SOLVABLE_LEVEL 49 // only the 3 last difficulties are implemented (see level_data.c)
+#define LAST_SOLVABLE_LEVEL 120
+#define MAX_NB_OF_BATCH_LEVELS (LAST_SOLVABLE_LEVEL - FIRST_SOLVABLE_LEVEL + 1)
+
+#define DEFAULT_BATCH_OUTPUT_PATH "batch_results.csv"
+
+#define ONE_THREAD_PER_LEVEL -1 // split depth of the batch mode when levels are not shared between threads (see batch_solver.c)
+
+typedef enum SolverEngine
+{
+    BACKTRACKING_ENGINE, // search_algorithm.c, through parallel_search.c
+    DLX_ENGINE,          // dlx_solver.c
+    ANCHOR_ENGINE,       // anchor_search.c
+    MRV_ENGINE,          // mrv_search.c
+    ASTAR_ENGINE,        // same as BACKTRACKING_ENGINE, with the previous dead end check (see check_board.c > "check_no_dead_ends_with_astar"), to benchmark it
+    NB_OF_ENGINES
+
+} SolverEngine;
+
+// Error codes of batch functions
+#define INVALID_LEVEL_LIST -1
+#define CANT_OPEN_OUTPUT_FILE -2
+#define INVALID_ENGINE -3
+#define ENGINES_DISAGREE -4
+#define INVALID_SPLIT_DEPTH -5
+#define INVALID_DISJOINT_PATHS_DEPTHS -6
+
+int parse_level_list(const char *level_list_str, int level_num_array[MAX_NB_OF_BATCH_LEVELS]);
+void solve_levels_in_batch(int level_num_array[], int nb_of_levels, int nb_of_threads, int split_depth, SolverEngine engine, CheckSettings check_settings, SolverResult result_array[]);
+int write_batch_results(SolverResult result_array[], int nb_of_levels, const char *output_path);
+
+int run_batch_mode(int argc, char *argv[]);
+int run_engine_comparison_mode(int argc, char *argv[]);
+
+#endif
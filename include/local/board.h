@@ -11,25 +11,126 @@
 
 #include <stdbool.h>
 #include <stdlib.h> // NULL
+#include <stdint.h> // int8_t, uint8_t, int16_t, uint32_t, uint64_t
 
 #include <local/utils.h>      // defines
 #include <local/piece_data.h> // Tile, Piece, and defines
-#include <local/level_data.h> // LevelHints, and defines
+#include <local/level_data.h> // LevelHints, LevelPlacements, and defines
+#include <local/placement.h>  // MAX_NB_OF_PLACEMENTS
 
 #define MAX_NB_OF_DOUBLE_MISSING_CONNECTION_TIlES_ON_BOARD 2
-#define NB_OF_GRID_LINES (BOARD_WIDTH + BOARD_HEIGHT + 2)
 
 #define UNDEFINED_TILE NULL
 
+// a region holds at least 1 empty tile, or has been entirely filled by 1 piece (which covers at least 1 tile), so there can't be more regions than tiles
+#define MAX_NB_OF_EMPTY_REGIONS BOARD_TOTAL_NB_TILES
+
+/**
+ * @struct EmptyRegionSplit
+ * Undo log entry of the empty regions of the board, 1 per added piece (see board.c > "split_empty_region")
+ */
+typedef struct EmptyRegionSplit
+{
+    int region_idx;        // index of the region the piece has been added in
+    uint32_t region_mask;  // this region before the piece was added
+    int nb_of_new_regions; // regions appended at the end of Board::empty_region_mask_array, because the piece has cut the region in several parts
+
+} EmptyRegionSplit;
+
+// no normal tile at this position (see BoardCell::piece_idx)
+#define NO_PIECE -1
+
+/**
+ * @struct BoardCell
+ * What is on 1 position of the board, in a fixed size slot (instead of a linked stack of the superposed tiles)
+ * so that every question about a position is answered with a single load, and the whole board state is a flat array of small integers
+ *
+ * The normal tile is referenced by its piece and its index in the current side of the piece, and the missing connection tiles by their path end index (see Tile::path_end_idx)
+ * (2 missing connection tiles at the same position always come from 2 different neighbours, so they are indexed by their direction)
+ */
+typedef struct BoardCell
+{
+    int8_t piece_idx;                            // piece of the normal tile at this position, NO_PIECE if there is none
+    int8_t tile_idx;                             // index of the normal tile in Side::tile_array of the current side of the piece
+    uint8_t normal_connection_mask;              // connection mask of the normal tile (see Tile::connection_mask), 0 if there is none
+    uint8_t nb_of_missing_connections;           // number of missing connection tiles at this position (at most 2)
+    uint8_t missing_connection_mask;             // OR of the connection masks of the missing connection tiles at this position (the connections a normal tile there must have)
+    int8_t path_end_idx_array[NB_OF_DIRECTIONS]; // direction of a missing connection tile at this position -> its path end index (only the directions of missing_connection_mask are meaningful)
+
+} BoardCell;
+
+// each adding changes at most 2 partners per missing connection tile of the piece (see board.c > "link_path_ends")
+#define MAX_NB_OF_PATH_PARTNER_CHANGES (NB_OF_PIECES * 2 * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE)
+
+/**
+ * @struct PathPartnerChange
+ * Journal entry of the path partners of the board (see board.c > "set_path_partner")
+ */
+typedef struct PathPartnerChange
+{
+    int8_t path_end_idx;
+    int8_t previous_partner_idx;
+
+} PathPartnerChange;
+
+/**
+ * @struct PathJoins
+ * What an adding has done to the paths of the board, 1 per added piece (see board.c > "join_paths_of_added_piece")
+ */
+typedef struct PathJoins
+{
+    int first_change_idx; // index in Board::path_partner_journal of the first change made by the adding
+    int nb_of_new_loops;  // paths that have been closed on themselves by the adding
+
+} PathJoins;
+
 /**
  * @struct Board
  */
 typedef struct Board
 {
 
-    Tile *tile_matrix[BOARD_WIDTH][BOARD_HEIGHT];            // Matrix of Tile pointers which represents the main data of the board (array of columns), each location is now a start for a stack (history of tile superposition)
+    BoardCell cell_array[BOARD_TOTAL_NB_TILES];              // main data of the board, indexed by bit index (see utils.h > bitboard stuff), kept up to date by "add_piece_to_board" and "undo_last_piece_adding"
     Tile *obligatory_tile_matrix[BOARD_WIDTH][BOARD_HEIGHT]; // Matrix of Tile pointers which are part of level hints, see level_data.c
 
+    // Bitboard view of cell_array (see utils.h > bitboard stuff), kept up to date by "add_piece_to_board" and "undo_last_piece_adding"
+    // the most frequent questions asked to the board are answered with a single AND, instead of looking at each position
+    uint32_t normal_tile_mask;                    // bit set <=> there is a normal tile at this position
+    uint32_t missing_connection_tile_mask;        // bit set <=> there is at least 1 missing connection tile at this position
+    uint32_t double_missing_connection_tile_mask; // bit set <=> there are 2 missing connection tiles at this position
+
+    // Connected components of the empty tiles (empty in terms of normal tiles only), also kept up to date by "add_piece_to_board" and "undo_last_piece_adding"
+    // so that the post-adding checks (see check_board.c) get the region of any empty tile with 2 lookups, instead of flood filling the board at each node
+    uint32_t empty_region_mask_array[MAX_NB_OF_EMPTY_REGIONS]; // a region entirely filled by a piece stays in the array, with an empty mask
+    int nb_of_empty_regions;
+    int8_t empty_region_idx_array[BOARD_TOTAL_NB_TILES];     // bit index of an empty tile -> index of its region in empty_region_mask_array
+    EmptyRegionSplit empty_region_split_array[NB_OF_PIECES]; // undo log, indexed by the number of added pieces before the adding
+
+    // Tiles where a future path has to end (see board.c > "update_open_endpoint_tile_mask"), the open endpoints of a region are then : region_mask & open_endpoint_tile_mask
+    uint32_t obligatory_point_tile_mask; // point tiles of the level hints
+    uint32_t open_endpoint_tile_mask;
+
+    // Paths of the board, also kept up to date by "add_piece_to_board" and "undo_last_piece_adding" (see board.c > "join_paths_of_added_piece")
+    // each open end of a path (a missing connection tile of an added piece, see Tile::path_end_idx) -> the other end of the same path (NO_PATH_END if it is a point tile)
+    // so that the no loop check (see check_board.c) is only comparisons, instead of following paths tile by tile
+    int8_t path_partner_idx_array[NB_OF_PATH_ENDS];
+    PathPartnerChange path_partner_journal[MAX_NB_OF_PATH_PARTNER_CHANGES]; // undo log of path_partner_idx_array
+    int path_partner_journal_length;
+    PathJoins path_joins_array[NB_OF_PIECES]; // indexed by the number of added pieces before the adding
+    int nb_of_loops;                          // paths closed on themselves, that are on the board
+
+    // Zobrist key of the board state (see transposition_table.c), also kept up to date by "add_piece_to_board" and "undo_last_piece_adding"
+    uint64_t zobrist_key;
+
+    // Tile types of the level hints, for the tile type budget check (see check_board.c > "check_tile_type_budget")
+    bool has_full_tile_type_hints;                                     // the level hints give the tile type of every position (expert levels)
+    uint32_t obligatory_tile_type_mask_array[NB_OF_NORMAL_TILE_TYPES]; // bit set <=> the level hint tile at this position has this type
+    uint8_t playable_side_mask_array[NB_OF_PIECES];                    // bit side_idx set <=> the side can match the tile types of the level hints (all sides by default, see check_board.c > "prune_playable_sides_with_tile_type_budget")
+
+    // Placements of the pieces that aren't level pieces, that fit on the level hints board (see level_data.h > LevelPlacements)
+    // read-only, shared by all the boards of the same level (per-thread boards of parallel_search.c included)
+    const LevelPlacements *level_placements;
+
     // informations inherited from level hints, useful for no dead end check (see check_board.c > "check_no_dead_ends")
     Tile *open_obligatory_point_tile_array[MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL];
     int nb_of_open_obligatory_point_tiles;
@@ -50,8 +151,7 @@ typedef struct Board
     Vector2_int temp_bend_double_missing_connection_position;
     Vector2_int temp_line_double_missing_connection_position;
 
-    // ------ Drawing data specific to the board
-    Vector2 grid_lines_pt_array[NB_OF_GRID_LINES][2];
+    // ------ Level hints kept to draw the board (the drawing data itself is in display.c > BoardDrawing)
     Tile *obligatory_tile_array; // instead of finding them in obligatory tile matrix to draw them, this is a direct copy from level hints see level_data.c
     int nb_of_obligatory_tiles;
 
@@ -74,13 +174,18 @@ Board *init_board(LevelHints *level_hints);
 #define TRIPLE_MISSING_CONNECTION_TILE -5
 #define INVALID_DOUBLE_MISSING_CONNECTION -6
 
+int add_placement_to_board(Board *board, int placement_idx); // see placement.h
+int can_placement_idx_be_added_to_board(Board *board, int placement_idx);
 int add_piece_to_board(Board *board, int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state);
 
 void undo_last_piece_adding(Board *board);
 
 // ------------ other public tools to interact with the board state ----------------------------------------------------
-Tile *extract_normal_tile_from_stack(Tile *tile_stack);
 Tile *extract_normal_tile_at_pos(Board *board, Vector2_int *base_pos);
-int get_number_of_missing_connection_in_stack(Tile *tile_stack);
+Tile *extract_missing_connection_tile_at_pos(Board *board, Vector2_int *base_pos);
+uint8_t get_tile_connection_mask(Tile *tile);
+Tile *get_path_end_tile(Board *board, int path_end_idx);
+int get_first_level_placement_pos(Board *board, int piece_idx, int side_idx, int placement_idx);
+void print_level_placement_stats(Board *board);
 
 #endif
\ No newline at end of file
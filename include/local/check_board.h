@@ -13,14 +13,37 @@
 
 #include <stdbool.h>
 
-#include <local/board.h> // Board
+#include <local/board.h>          // Board
+#include <local/solver_context.h> // SolverContext
 
 // Error codes if a check doesn't pass, potential return values of "run_all_checks"
 #define ISOLATED_EMPTY_TILE -1
 #define DEAD_END -2
 #define DOUBLE_MISSING_CONNECTION_NOT_FILLABLE -3
 #define LOOP_PATH -4
+#define REGION_SIZES_NOT_FILLABLE -5
+#define ODD_NB_OF_PATH_ENDS -6
+#define PATH_ENDS_NOT_LINKABLE -7
+#define COLOUR_IMBALANCE_NOT_FILLABLE -8
+#define TILE_TYPES_NOT_FILLABLE -9
+#define SMALL_REGION_NOT_FILLABLE -10
 
-int run_all_checks(Board *board, bool enable_not_worth_checks);
+// Set CheckSettings::use_astar_dead_end_check (see solver_context.h) to run the dead end check with the previous pathfinding version (see check_board.c, and the "astar" engine of batch_solver.c)
+
+// The disjoint paths check (see check_board.c > "check_disjoint_paths") costs a few max flow computations
+// so it only runs at the depths (number of pieces on the board) where its profiling counters show that it pays off, or at every depth with enable_not_worth_checks
+// These are the default depths of CheckSettings, they can be changed at runtime to measure other ones (see batch_solver.c > "--disjoint-paths-depths")
+//
+// Measured on levels 49 to 120 (backtracking engine, 1 thread), with the check at every depth, cuts / calls per depth :
+// depth 1 : 1/290, 2 : 13/1882, 3 : 100/8999, 4 : 200/11972, 5 : 117/3945, 6 : 14/455, 7 and more : 0 cut
+// Below depth 6 it cuts 1 to 3% of many more boards, and the batch gets slower (depth 5 : about +15 ms, depth 4 : +50 ms, every depth : +110 ms, out of about 70 ms)
+// Depth 6 is the last one where it still cuts boards, deeper it is only a cost
+#define FIRST_DISJOINT_PATHS_CHECK_DEPTH 6
+#define LAST_DISJOINT_PATHS_CHECK_DEPTH 6
+#define MAX_NB_OF_PATH_ENDS_FOR_DISJOINT_PATHS_CHECK 8
+
+int run_all_checks(Board *board, SolverContext *context, bool enable_not_worth_checks);
+void print_disjoint_paths_check_stats(SolverContext *context);
+void prune_playable_sides_with_tile_type_budget(Board *board, bool playable_side_per_piece_idx_mask[][MAX_NB_OF_SIDE_PER_PIECE]);
 
 #endif
\ No newline at end of file
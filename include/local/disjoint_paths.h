@@ -0,0 +1,16 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file disjoint_paths.h
+ * @see disjoint_paths.c
+ */
+
+#ifndef __DISJOINT_PATHS_H__
+#define __DISJOINT_PATHS_H__
+
+#include <stdint.h> // uint32_t
+
+int get_max_nb_of_disjoint_paths(uint32_t free_tile_mask, uint32_t source_tile_mask, uint32_t sink_tile_mask, int nb_of_paths_needed);
+
+#endif
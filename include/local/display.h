@@ -11,6 +11,8 @@
 
 #include <stdbool.h>
 
+#include <raylib/raylib.h> // Vector2
+
 #include <local/utils.h>      // Vector2_int
 #include <local/piece_data.h> // Piece and defines
 #include <local/board.h>      // Board
@@ -22,9 +24,48 @@
 #define UNDO_ERROR 101
 #define BOARD_COMPLETED 102
 #define ALL_PIECE_PLAYED 103
+#define POST_ADDING_CHECK_STATUS_OFFSET 50 // added to the error codes of "run_all_checks" (see check_board.h), so that they don't collide with the ones of "add_piece_to_board" (see board.h)
 
 #define DEFAULT_ICON_PIXEL_SIZE 16 // 16*16 square
 
+/**
+ * @struct TileDrawing
+ * Cached drawing data of a Tile (see display.c description)
+ */
+typedef struct TileDrawing
+{
+    Vector2_int top_left_corner_pt;
+    Vector2 center_pt;
+    Vector2 connection_pt_array[MAX_NB_OF_CONNECTION_PER_TILE];
+
+} TileDrawing;
+
+/**
+ * @struct PieceDrawing
+ * Cached drawing data of a Piece, in its current blit (only the tiles of the current side are needed)
+ */
+typedef struct PieceDrawing
+{
+    TileDrawing tile_drawing_array[MAX_NB_OF_TILE_PER_SIDE];                                    // matching Side::tile_array
+    TileDrawing missing_connection_tile_drawing_array[MAX_NB_OF_MISSING_CONNECTION_PER_SIDE]; // matching Side::missing_connection_tile_array
+    Vector2_int border_tile_effective_absolute_top_left_corner_pt_array[MAX_NB_OF_BORDER_TILE_PER_SIDE];
+    Vector2 outline_tile_effective_absolute_top_left_corner_pt_array[MAX_NB_OF_OUTLINE_POINTS];
+
+} PieceDrawing;
+
+/**
+ * @struct BoardDrawing
+ * Cached drawing data of a Board
+ * The solver structs (Tile, Piece, Board) don't hold any drawing data : whatever draws a board allocates its BoardDrawing next to it (see "init_board_drawing"),
+ * and frees it with the board
+ */
+typedef struct BoardDrawing
+{
+    PieceDrawing piece_drawing_array[NB_OF_PIECES];                  // indexed by piece_idx, matching Board::piece_array
+    TileDrawing obligatory_tile_drawing_array[BOARD_TOTAL_NB_TILES]; // matching Board::obligatory_tile_array
+
+} BoardDrawing;
+
 extern const int tile_px_width;
 extern const int gui_icon_scale;
 extern Vector2_int offset_px;
@@ -34,13 +75,16 @@ void setup_display(int window_px_width, int window_px_height);
 
 //----- Main drawing functions
 
+const char *get_piece_name(int piece_idx);
+
 void draw_grid();
 
-void update_piece_all_drawing(Piece *piece, bool show_missing_connection_tiles, bool show_border_tiles);
-void draw_piece(Piece *piece, bool show_missing_connection_tiles, bool show_border_tiles);
+void update_piece_all_drawing(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles, bool show_border_tiles);
+void draw_piece(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles, bool show_border_tiles);
 
-void update_board_static_drawing(Board *board);
-void draw_board(Board *board);
+BoardDrawing *init_board_drawing(void);
+void update_board_static_drawing(Board *board, BoardDrawing *board_drawing);
+void draw_board(Board *board, BoardDrawing *board_drawing);
 
 //----- More interface displayed
 
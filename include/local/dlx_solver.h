@@ -0,0 +1,60 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file dlx_solver.h
+ * @see dlx_solver.c
+ */
+
+#ifndef __DLX_SOLVER_H__
+#define __DLX_SOLVER_H__
+
+#include <local/utils.h>           // BOARD_WIDTH, BOARD_HEIGHT, BOARD_TOTAL_NB_TILES
+#include <local/piece_data.h>      // NB_OF_PIECES, MAX_NB_OF_TILE_PER_SIDE
+#include <local/placement.h>       // MAX_NB_OF_PLACEMENTS
+#include <local/board.h>           // Board
+#include <local/parallel_search.h> // SolverResult
+
+#define NB_OF_BOARD_EDGES ((BOARD_WIDTH - 1) * BOARD_HEIGHT + BOARD_WIDTH * (BOARD_HEIGHT - 1)) // sides shared by 2 positions of the board
+
+#define MAX_NB_OF_DLX_ITEMS (BOARD_TOTAL_NB_TILES + NB_OF_PIECES + NB_OF_BOARD_EDGES)
+#define MAX_NB_OF_NODES_PER_DLX_ROW (1 + MAX_NB_OF_TILE_PER_SIDE * (1 + NB_OF_DIRECTIONS)) // piece + positions + edges around each position
+#define MAX_NB_OF_DLX_NODES (1 + MAX_NB_OF_DLX_ITEMS + MAX_NB_OF_PLACEMENTS * (MAX_NB_OF_NODES_PER_DLX_ROW + 1) + 1)
+
+// colors of the edge items (0 is "no color" in Knuth's algorithm C)
+#define NOT_CONNECTED_EDGE 1
+#define CONNECTED_EDGE 2
+
+/**
+ * @struct DlxMatrix
+ * Exact cover matrix of 1 level, in the layout of Knuth's "Dancing links" (The Art of Computer Programming, Volume 4B, 7.2.2.1)
+ *
+ * Items 1 to nb_of_primary_items are the empty positions of the board and the pieces to add (to cover exactly once),
+ * then come the secondary items, the board edges between 2 empty positions (to cover at most once, or many times with the same color)
+ * Nodes 1 to nb_of_items are the item headers, then come the rows (1 row = 1 placement, see placement.h) separated by spacer nodes
+ */
+typedef struct DlxMatrix
+{
+    // ------ Items, 0 is the head of the list of the primary items left to cover
+    int item_left_array[MAX_NB_OF_DLX_ITEMS + 1];
+    int item_right_array[MAX_NB_OF_DLX_ITEMS + 1];
+    int nb_of_items;
+    int nb_of_primary_items;
+
+    // ------ Nodes
+    int top_array[MAX_NB_OF_DLX_NODES]; // item of a node, number of nodes left in the item for a header, -(row idx) for a spacer
+    int up_array[MAX_NB_OF_DLX_NODES];
+    int down_array[MAX_NB_OF_DLX_NODES];
+    int color_array[MAX_NB_OF_DLX_NODES]; // -1 once a node has been purified
+    int nb_of_nodes;
+
+    // ------ Rows
+    int row_placement_idx_array[MAX_NB_OF_PLACEMENTS];
+    int nb_of_rows;
+
+} DlxMatrix;
+
+SolverResult solve_level_with_dlx(int level_num, Board **solution_board);
+void run_algorithm_with_dlx(int level_num);
+
+#endif
@@ -9,11 +9,20 @@
 #ifndef __LEVEL_DATA_H__
 #define __LEVEL_DATA_H__
 
+#include <stdbool.h>
+#include <stdint.h> // int16_t, uint64_t
+
 #include <local/utils.h>      // Vector2_int and defines
 #include <local/piece_data.h> // Tile and defines
+#include <local/placement.h>  // MAX_NB_OF_PLACEMENTS
 
 #define MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL 6
 
+#define NB_OF_LEVEL_PLACEMENT_WORDS ((MAX_NB_OF_PLACEMENTS + 63) / 64)
+
+// bit placement_idx of LevelPlacements::level_placement_bitset, see below
+#define IS_LEVEL_PLACEMENT(level_placements, placement_idx) (((level_placements)->level_placement_bitset[(placement_idx) >> 6] >> ((placement_idx) & 63)) & 1)
+
 /**
  * @struct PieceAddInfos
  * Struct to record obligatory piece hints in levels
@@ -28,6 +37,26 @@ typedef struct PieceAddInfos
 
 } PieceAddInfos;
 
+/**
+ * @struct LevelPlacements
+ * Placements of the pieces that aren't level pieces, that fit on the level hints board (see board.c > "load_level_placements")
+ * the level hints and the level pieces never leave the board, so the other placements can never be added : the search only goes through these ones
+ *
+ * They only depend on the level, so they are computed by the first board of the level, and every board of the level reads them (see Board::level_placements)
+ */
+typedef struct LevelPlacements
+{
+    bool is_loaded;
+
+    // the ones of a piece side are level_placement_idx_array[k], for k in [first_level_placement_idx_array[piece_idx][side_idx], first_level_placement_idx_array[piece_idx][side_idx + 1][ (in the same order as placement_array)
+    int16_t level_placement_idx_array[MAX_NB_OF_PLACEMENTS];
+    int first_level_placement_idx_array[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE + 1];
+    uint64_t level_placement_bitset[NB_OF_LEVEL_PLACEMENT_WORDS]; // bit placement_idx set <=> it is in level_placement_idx_array (its tiles are then known to match the level hints)
+    int nb_of_level_placements;
+    int nb_of_non_level_piece_placements; // all the placements of the pieces that aren't level pieces, to see how much the level hints shrink the search space
+
+} LevelPlacements;
+
 /**
  * @struct LevelHints
  * Struct to record 1 level hints
@@ -43,6 +72,8 @@ typedef struct LevelHints
     int open_obligatory_point_tile_idx_array[MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL];
     int nb_of_open_obligatory_point_tiles;
 
+    LevelPlacements level_placements; // loaded by the first "init_board" of the level
+
 } LevelHints;
 
 LevelHints *get_level_hints(int level_num);
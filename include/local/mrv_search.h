@@ -0,0 +1,44 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file mrv_search.h
+ * @see mrv_search.c
+ */
+
+#ifndef __MRV_SEARCH_H__
+#define __MRV_SEARCH_H__
+
+#include <stdbool.h>
+#include <stdint.h> // int16_t
+
+#include <local/piece_data.h>      // NB_OF_PIECES, MAX_NB_OF_SIDE_PER_PIECE
+#include <local/placement.h>       // MAX_NB_OF_PLACEMENTS
+#include <local/board.h>           // Board
+#include <local/parallel_search.h> // SolverResult
+
+/**
+ * @struct MrvSearchState
+ * Current state of the exploration of 1 combination, with the most constrained variable strategy (see mrv_search.c)
+ */
+typedef struct MrvSearchState
+{
+    // ------ Combination data (see search_algorithm.c > "load_combination_data")
+    int piece_idx_priority_array[NB_OF_PIECES];
+    int nb_of_playable_pieces;
+    bool playable_side_per_piece_idx_mask[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE];
+
+    bool is_piece_added_array[NB_OF_PIECES]; // pieces of piece_idx_priority_array that are on the board
+
+    // ------ Placements of the remaining pieces that still pass the pre-adding checks, at each depth (depth = number of pieces added since the start of the combination)
+    int16_t candidate_placement_idx_array[NB_OF_PIECES + 1][MAX_NB_OF_PLACEMENTS];
+    int nb_of_candidates_array[NB_OF_PIECES + 1];
+
+    int valid_board_count;
+
+} MrvSearchState;
+
+SolverResult solve_level_with_mrv(int level_num, Board **solution_board);
+void run_algorithm_with_mrv(int level_num);
+
+#endif
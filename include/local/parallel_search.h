@@ -0,0 +1,48 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file parallel_search.h
+ * @see parallel_search.c
+ */
+
+#ifndef __PARALLEL_SEARCH_H__
+#define __PARALLEL_SEARCH_H__
+
+#include <stdbool.h>
+
+#include <local/board.h>          // Board
+#include <local/piece_data.h>     // NB_OF_PIECES
+#include <local/solver_context.h> // CheckSettings
+
+#define MAX_NB_OF_SOLVER_THREADS 64
+#define DEFAULT_NB_OF_SOLVER_THREADS 4
+#define DEFAULT_SPLIT_DEPTH 4 // pieces of piece_idx_priority_array whose placements can be stolen by idle threads (see parallel_search.c)
+
+/**
+ * @struct SolverResult
+ * Outcome of 1 solve of 1 level, see parallel_search.c
+ */
+typedef struct SolverResult
+{
+    int level_num;
+    bool solved;
+    int valid_board_count; // summed over all the threads (see search_algorithm.c description)
+    double wall_time;      // seconds, loop only part (like the other run_algorithm_*** functions)
+    double cpu_time;       // seconds, summed over all the threads
+
+    // ------ Per thread stats
+    int nb_of_threads;
+    int node_count_array[MAX_NB_OF_SOLVER_THREADS];  // valid boards found by each thread
+    int steal_count_array[MAX_NB_OF_SOLVER_THREADS]; // subtrees stolen by each thread
+
+    // ------ check_board.c > "check_disjoint_paths" profiling counters per depth (see SolverContext), summed over all the threads
+    long long disjoint_paths_check_nb_of_calls_array[NB_OF_PIECES + 1];
+    long long disjoint_paths_check_nb_of_cuts_array[NB_OF_PIECES + 1];
+
+} SolverResult;
+
+SolverResult solve_level_in_parallel(int level_num, int nb_of_threads, int split_depth, CheckSettings check_settings, Board **solution_board);
+void run_algorithm_in_parallel(int level_num, int nb_of_threads, int split_depth);
+
+#endif
@@ -29,11 +29,14 @@
 #define tile_connection_directions_computation()                                                                                                                            \
     do                                                                                                                                                                      \
     {                                                                                                                                                                       \
+        current_tile->connection_mask = 0;                                                                                                                                  \
         for (connection_idx = 0; connection_idx < current_tile->nb_of_connections; connection_idx++)                                                                        \
+        {                                                                                                                                                                   \
             current_tile->connection_direction_array[connection_idx] = rotate_direction(current_tile->constant_connection_direction_array[connection_idx], rotation_state); \
+            current_tile->connection_mask |= DIRECTION_TO_MASK(current_tile->connection_direction_array[connection_idx]);                                                    \
+        }                                                                                                                                                                   \
     } while (0)
 
 void blit_piece_main_data(Piece *piece, int side_idx, Vector2_int base_pos, int rotation_state);
-void update_piece_border_tiles(Piece *piece);
 
 #endif
\ No newline at end of file
@@ -13,8 +13,7 @@
 
 #include <stdbool.h>
 #include <stdlib.h>
-
-#include <raylib/raylib.h> //Vector2
+#include <stdint.h> // uint8_t, uint32_t
 
 #include <local/utils.h> //Vector2_int, Direction
 
@@ -32,7 +31,6 @@
 
 #define MAX_NB_OF_TILE_PER_SIDE 4
 #define MAX_NB_OF_MISSING_CONNECTION_PER_SIDE 4
-#define MAX_NB_OF_DISTINCT_PATH_PER_SIDE 2
 #define MAX_NB_OF_BORDER_TILE_PER_SIDE 9
 #define MAX_NB_OF_OUTLINE_POINTS 9
 
@@ -40,6 +38,9 @@
 
 #define NB_OF_PIECES 10
 
+#define NO_PATH_END -1                                                         // the path ends on a point tile, see Side::path_partner_missing_connection_tile_idx_array
+#define NB_OF_PATH_ENDS (NB_OF_PIECES * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE) // see Tile::path_end_idx
+
 /**
  * @def LINE2_1, one of many identifier of the actual game pieces
  * endoded in the form of int indexes
@@ -72,31 +73,37 @@ typedef enum TileType
 
 } TileType;
 
+#define NB_OF_NORMAL_TILE_TYPES 4 // point, line, bend and empty (missing connection tiles aren't normal tiles)
+
+// number of tiles of each normal tile type, packed in a uint32_t (8 bits per type, see Side::tile_type_counts)
+// so that the tile type counts of several sides are added or subtracted all at once
+#define TILE_TYPE_COUNT_SHIFT(tile_type) ((tile_type) * 8)
+#define TILE_TYPE_COUNT(tile_type_counts, tile_type) (((tile_type_counts) >> TILE_TYPE_COUNT_SHIFT(tile_type)) & 0xFF)
+// true if "tile_type_counts_b" has at most as many tiles of each type as "tile_type_counts_a" (each byte is compared at once, counts must be lower than 128)
+#define ARE_TILE_TYPE_COUNTS_ENOUGH(tile_type_counts_a, tile_type_counts_b) (((((tile_type_counts_a) | 0x80808080) - (tile_type_counts_b)) & 0x80808080) == 0x80808080)
+
 /**
  * @struct Tile
  * elementary tile present in the game
  */
 typedef struct Tile
 {
-    // ----------- Definition of a tile ----------
-    TileType tile_type;
-    Vector2_int relative_pos;                                               // relative position of tile in the definition of a side
-    int nb_of_connections;                                                  // length of matching arrays
-    int constant_connection_direction_array[MAX_NB_OF_CONNECTION_PER_TILE]; // base connections of the tile
+    // The fields read by the board checks come first, and small values are stored in int8_t (directions, indexes and counts are all below 128)
+    // so that a tile is 28 bytes instead of 48 : tiles are copied 10 pieces * 3 sides * 8 tiles at a time in every Board
 
     // ----------- Live data part -----------------
+    Vector2_int absolute_pos;                                         // absolute position of the tile on the board, computed when we blit a piece to the board
+    TileType tile_type;                                               // (definition, but read with the live data)
+    uint8_t connection_mask;                                          // 4-bit mask of connection_direction_array (see utils.h > DIRECTION_TO_MASK), so that connections are matched with a single AND
+    int8_t nb_of_connections;                                         // length of matching arrays (definition, but read with the live data)
+    int8_t connection_direction_array[MAX_NB_OF_CONNECTION_PER_TILE]; // connections are changed by rotation of the piece when it is blitted
+    int8_t path_end_idx;                                              // (definition, missing connection tiles only) index of this path end in Board::path_partner_idx_array, see board.c
 
-    // ------ Main
-    Vector2_int absolute_pos;                                      // absolute position of the tile on the board, computed when we blit a piece to the board
-    int connection_direction_array[MAX_NB_OF_CONNECTION_PER_TILE]; // connections are changed by rotation of the piece when it is blitted
-
-    // ------ Only useful to board matrix see board.c
-    struct Tile *next; // start of a stack
+    // ----------- Definition of a tile ----------
+    int8_t constant_connection_direction_array[MAX_NB_OF_CONNECTION_PER_TILE]; // base connections of the tile
+    Vector2_int relative_pos;                                                  // relative position of tile in the definition of a side
 
-    // ------ Drawing data cache
-    Vector2_int top_left_corner_pt;
-    Vector2 center_pt;
-    Vector2 connection_pt_array[MAX_NB_OF_CONNECTION_PER_TILE];
+    // (drawing data is not cached here, see display.h > TileDrawing)
 
 } Tile;
 
@@ -106,23 +113,23 @@ typedef struct Tile
 typedef struct Side
 {
     // ----------- Definition of a side ----------
-    int nb_of_tiles;                    // length of matching array
-    int nb_of_missing_connection_tiles; // length of matching array
+    int8_t nb_of_tiles;                    // length of matching array
+    int8_t nb_of_missing_connection_tiles; // length of matching array
     Tile tile_array[MAX_NB_OF_TILE_PER_SIDE];
     Tile missing_connection_tile_array[MAX_NB_OF_MISSING_CONNECTION_PER_SIDE];
 
-    Vector2_int border_tile_relative_pos_array[MAX_NB_OF_BORDER_TILE_PER_SIDE]; // not array of tiles but array of relative pos of border tiles which are directly in contact with the piece (no diagonal)
-    Vector2_int outline_tile_relative_pos_array[MAX_NB_OF_OUTLINE_POINTS];      // array of relative pos of tiles which have their top-left corners used to draw an outline around the piece
+    // (border tiles are in side_border_tile_relative_pos_array below, and outline tiles in display.c, as the board checks never read them)
+
+    // For the no loop post-adding check -> see check_board.c and board.c > "join_paths_of_added_piece"
+    // index of the missing connection tile at the other end of the same path inside the side, or NO_PATH_END if the path ends on a point tile of the side
+    // (not encoded by hand, it is computed from the tile connections, see piece_data.c > "load_path_partners")
+    int8_t path_partner_missing_connection_tile_idx_array[MAX_NB_OF_MISSING_CONNECTION_PER_SIDE];
 
-    // For the no loop post-adding check -> see check_board.c
-    // what is contained in this array ?
-    // 1) missing connection tile idx of a side, that are not directly linked to a point tile
-    // 2) if 2 of these missing connection tiles pass the condition 1), but are linked together -> take only one of them
-    // encoded by hand for each side of each piece
-    int susceptible_loop_generator_missing_connection_tile_idx_array[MAX_NB_OF_DISTINCT_PATH_PER_SIDE];
-    int nb_of_susceptible_loop_generator_tiles;
+    // For the tile type budget post-adding check -> see check_board.c > "check_tile_type_budget"
+    // number of normal tiles of each type (see TILE_TYPE_COUNT_SHIFT), also computed in piece_data.c > "load_tile_type_counts"
+    uint32_t tile_type_counts;
 
-    int max_nb_of_rotations; // if we need to limit this specific side nb of rotations in the search algorithm
+    int8_t max_nb_of_rotations; // if we need to limit this specific side nb of rotations in the search algorithm
     // default to NB_OF_DIRECTIONS (4), but rather useful if the side is symmetric, we can reduce duplicate valid boards by lowering this constant
     // regarding real game pieces, Line pieces have a side full of empty tiles, we only need to test them horizontally and vertically for example
     // so max_nb_of_rotations is 2 for them
@@ -142,12 +149,10 @@ typedef struct Side
 typedef struct Piece
 {
     // ----------- Definition of a piece ----------
-    const char *name;
+    int8_t piece_idx; // index of the piece (LINE2_1 ...), to find its data that isn't in the struct (border tiles below, name and outline in display.c)
     bool has_point_on_first_side;
-    int piece_height;                          // vertical space taken by the piece in its default orientation (in number of tiles), useful to draw_piece_priority_array
-    int nb_of_sides;                           // length of matching array
-    int nb_of_border_tiles;                    // length of matching array (which is common between sides of the same piece)
-    int nb_of_outline_tiles;                   // length of matching array (which is common between sides of the same piece)
+    int8_t nb_of_sides;                        // length of matching array
+    int8_t nb_of_border_tiles;                 // length of matching arrays in side_border_tile_relative_pos_array (which is common between sides of the same piece)
     Side side_array[MAX_NB_OF_SIDE_PER_PIECE]; // array of sides : main data of the piece
 
     // ----------- Live data part -----------------
@@ -156,16 +161,15 @@ typedef struct Piece
     int current_side_idx;
     Vector2_int current_base_pos;
     int current_rotation_state;
+    int current_placement_idx; // index of the blit in placement_table (see placement.h), also the cursor of the search algorithm
 
-    // ------ Cached blit results
-    Vector2_int border_tile_absolute_pos_array[MAX_NB_OF_BORDER_TILE_PER_SIDE];
-
-    // ------ Drawing data cache
-    Vector2_int border_tile_effective_absolute_top_left_corner_pt_array[MAX_NB_OF_BORDER_TILE_PER_SIDE];
-    Vector2 outline_tile_effective_absolute_top_left_corner_pt_array[MAX_NB_OF_OUTLINE_POINTS];
+    // (drawing data is not cached here, see display.h > PieceDrawing)
 
 } Piece;
 
+// relative positions of the border tiles of each side, indexed by [piece_idx][side_idx], see piece_data.c
+extern const Vector2_int side_border_tile_relative_pos_array[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE][MAX_NB_OF_BORDER_TILE_PER_SIDE];
+
 void load_piece_array(Piece piece_array[NB_OF_PIECES]);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file placement.h
+ * @see placement.c
+ */
+
+#ifndef __PLACEMENT_H__
+#define __PLACEMENT_H__
+
+#include <stdbool.h>
+#include <stdint.h> // uint8_t, int8_t, int16_t, uint32_t, uint64_t
+
+#include <local/utils.h>      // Vector2_int, BOARD_WIDTH, BOARD_HEIGHT, BOARD_TOTAL_NB_TILES, NB_OF_DIRECTIONS
+#include <local/piece_data.h> // NB_OF_PIECES, MAX_NB_OF_SIDE_PER_PIECE, MAX_NB_OF_TILE_PER_SIDE, MAX_NB_OF_MISSING_CONNECTION_PER_SIDE
+
+/**
+ * @def MAX_NB_OF_PLACEMENTS
+ * Upper bound of the number of (piece, side, base_pos, rotation) combinations, the actual number of placements inside the board is a lot lower
+ */
+#define MAX_NB_OF_PLACEMENTS (NB_OF_PIECES * MAX_NB_OF_SIDE_PER_PIECE * BOARD_WIDTH * BOARD_HEIGHT * NB_OF_DIRECTIONS)
+
+// Upper bound of the number of (position, placement) pairs where the placement has a normal tile at the position
+#define MAX_NB_OF_COVERING_PLACEMENTS (MAX_NB_OF_PLACEMENTS * MAX_NB_OF_TILE_PER_SIDE)
+
+#define UNDEFINED_PLACEMENT_IDX -1 // placement idx of a blit that doesn't fit inside the board, also the reset value of Piece::current_placement_idx
+
+// colour imbalance "imbalance" (see utils.h > COLOUR_IMBALANCE_OF_MASK) is bit (imbalance + COLOUR_IMBALANCE_OFFSET) of a uint64_t
+// (all the pieces together have BOARD_TOTAL_NB_TILES tiles, so any total imbalance of some pieces is in [-BOARD_TOTAL_NB_TILES, BOARD_TOTAL_NB_TILES[ in practice)
+#define COLOUR_IMBALANCE_OFFSET BOARD_TOTAL_NB_TILES
+#define COLOUR_IMBALANCE_TO_BIT_MASK(imbalance) (((uint64_t)1) << ((imbalance) + COLOUR_IMBALANCE_OFFSET))
+
+/**
+ * @struct Placement
+ * Everything "can_piece_be_added_to_board" and "add_piece_to_board" need to know about 1 blit of a piece side,
+ * computed once and for all when the table is loaded, instead of running the rotation / translation math of piece.h at each try
+ * Only blits where all tiles (normal and missing connection ones) are inside the board are recorded
+ *
+ * Tile data arrays follow the same order as Side::tile_array and Side::missing_connection_tile_array
+ * Positions are stored as bit indexes (see utils.h > bitboard stuff), and connections as 4-bit direction masks (see utils.h > DIRECTION_TO_MASK)
+ */
+typedef struct Placement
+{
+    // ------ Blit inputs
+    int8_t piece_idx;
+    int8_t side_idx;
+    int8_t rotation_state;
+    Vector2_int base_pos;
+
+    // ------ Bitboards of the blit
+    uint32_t tile_mask;                    // footprint of normal tiles
+    uint32_t missing_connection_tile_mask; // footprint of missing connection tiles (2 missing connection tiles of the same side are never at the same position)
+    uint32_t border_tile_mask;             // tiles directly in contact with the piece (no diagonal), see piece_data.h > side_border_tile_relative_pos_array
+    uint32_t point_tile_mask;              // footprint of the point tile (0 if the side has no point), see search_algorithm.c > "add_piece_at_open_points"
+
+    // ------ Part of the board key that doesn't depend on the other pieces (normal tiles and added piece, see transposition_table.c)
+    uint64_t zobrist_key;
+
+    // ------ Normal tiles
+    uint8_t tile_bit_idx_array[MAX_NB_OF_TILE_PER_SIDE];
+    uint8_t tile_connection_mask_array[MAX_NB_OF_TILE_PER_SIDE];
+    int8_t tile_connection_direction_array[MAX_NB_OF_TILE_PER_SIDE][MAX_NB_OF_CONNECTION_PER_TILE]; // rotated Tile::constant_connection_direction_array
+
+    // ------ Missing connection tiles (they have exactly 1 connection)
+    uint8_t missing_connection_tile_bit_idx_array[MAX_NB_OF_MISSING_CONNECTION_PER_SIDE];
+    int8_t missing_connection_tile_direction_array[MAX_NB_OF_MISSING_CONNECTION_PER_SIDE];
+
+} Placement;
+
+/**
+ * @struct PlacementTable
+ * All placements of all pieces, in a flat array
+ *
+ * The placements that the search algorithm goes through (rotation_state < Side::max_nb_of_rotations) are ordered by piece, side, base_pos.i, base_pos.j, rotation_state
+ * which is the exact same order as the nested loops of the search algorithm were
+ * The placements of a piece side are in [first_placement_idx_array[piece_idx][side_idx], first_placement_idx_array[piece_idx][side_idx + 1][
+ *
+ * The remaining placements (rotation_state >= Side::max_nb_of_rotations) are stored after them
+ * they are only reachable through "placement_idx_lookup" (level hints or manual playing can still use them)
+ *
+ * The placements that the search algorithm goes through are also indexed by the positions they cover (see anchor_search.c) :
+ * the ones of a piece that have a normal tile at the position "bit_idx" are covering_placement_idx_array[k], for k in
+ * [first_covering_placement_idx_array[bit_idx][piece_idx], first_covering_placement_idx_array[bit_idx][piece_idx + 1][ (in the same order as placement_array)
+ * and the ones of a side with a point are indexed by the position of their point tile the same way (see search_algorithm.c > "add_piece_at_open_points") :
+ * point_placement_idx_array[k], for k in [first_point_placement_idx_array[bit_idx][piece_idx], first_point_placement_idx_array[bit_idx][piece_idx + 1][
+ *
+ * And the sizes that the subsets of pieces can fill are precomputed for every subset (a bitset dynamic programming, see placement.c > "load_subset_sizes")
+ * as well as their colour imbalances on a checkerboard colouring (see utils.h > BLACK_TILE_MASK, and placement.c > "load_subset_colour_imbalances")
+ */
+typedef struct PlacementTable
+{
+    Placement placement_array[MAX_NB_OF_PLACEMENTS];
+    int nb_of_placements;
+
+    int first_placement_idx_array[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE + 1];
+
+    int16_t placement_idx_lookup[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE][BOARD_WIDTH][BOARD_HEIGHT][NB_OF_DIRECTIONS]; // UNDEFINED_PLACEMENT_IDX if the blit doesn't fit inside the board
+
+    // ------ Position -> covering placements index
+    int16_t covering_placement_idx_array[MAX_NB_OF_COVERING_PLACEMENTS];
+    int first_covering_placement_idx_array[BOARD_TOTAL_NB_TILES][NB_OF_PIECES + 1];
+
+    // ------ Point position -> placements of a side with a point that have their point tile there
+    int16_t point_placement_idx_array[MAX_NB_OF_PLACEMENTS];
+    int first_point_placement_idx_array[BOARD_TOTAL_NB_TILES][NB_OF_PIECES + 1];
+
+    // ------ Piece subsets (bit piece_idx set <=> the piece is in the subset) -> number of tiles (see check_board.c > "check_region_sizes")
+    int8_t subset_nb_of_tiles_array[1 << NB_OF_PIECES]; // total number of normal tiles of the pieces of the subset
+    uint64_t subset_size_mask_array[1 << NB_OF_PIECES]; // bit n set <=> some pieces of the subset have n normal tiles in total
+
+    // ------ Piece subsets -> colour imbalances (see check_board.c > "check_colour_imbalance")
+    uint64_t subset_colour_imbalance_mask_array[1 << NB_OF_PIECES]; // COLOUR_IMBALANCE_TO_BIT_MASK(imbalance) set <=> the pieces of the subset, all on the board, can have this imbalance in total
+
+} PlacementTable;
+
+// read-only after "load_placement_table" has been called once
+extern PlacementTable placement_table;
+
+void load_placement_table(void);
+int get_placement_idx(int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state);
+
+#endif
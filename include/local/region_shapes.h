@@ -0,0 +1,54 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file region_shapes.h
+ * @see region_shapes.c
+ */
+
+#ifndef __REGION_SHAPES_H__
+#define __REGION_SHAPES_H__
+
+#include <stdbool.h>
+#include <stdint.h> // int16_t, uint8_t, uint32_t
+
+#include <local/utils.h>      // BOARD_TOTAL_NB_TILES
+#include <local/piece_data.h> // NB_OF_PIECES
+
+// empty regions up to this number of tiles are looked up in the region shape table (see check_board.c > "check_small_region_shapes")
+#define MAX_NB_OF_TILES_PER_SMALL_REGION 8
+
+// there are 2779 shapes of 1 to 8 tiles that fit inside the board, the hash table is kept less than half full
+#define REGION_SHAPE_HASH_TABLE_SIZE_LOG2 13
+#define REGION_SHAPE_HASH_TABLE_SIZE (1 << REGION_SHAPE_HASH_TABLE_SIZE_LOG2)
+
+// upper bound of the number of (shape, piece subset) pairs recorded in the table (there are 22388 of them with the actual game pieces)
+#define MAX_NB_OF_REGION_SHAPE_TILINGS 32768
+
+/**
+ * @struct RegionShapeTable
+ * All shapes of 1 to MAX_NB_OF_TILES_PER_SMALL_REGION connected tiles that fit inside the board, and the subsets of pieces that can fill each of them
+ *
+ * A shape is the tile mask of a region moved to the top left corner of the board (see utils.h > bitboard stuff, and region_shapes.c > "get_shape_mask")
+ * it is the key of an open addressing hash table : the slot of a shape is shape_mask_array[slot] (0 for an empty slot)
+ * the subsets of pieces that can fill the shape are tiling_piece_mask_array[k], for k in [first_tiling_idx_array[slot], first_tiling_idx_array[slot] + nb_of_tilings_array[slot][
+ * (bit piece_idx set <=> the piece is in the subset, a shape that no subset of pieces can fill has 0 tilings)
+ */
+typedef struct RegionShapeTable
+{
+    uint32_t shape_mask_array[REGION_SHAPE_HASH_TABLE_SIZE];
+    int first_tiling_idx_array[REGION_SHAPE_HASH_TABLE_SIZE];
+    uint8_t nb_of_tilings_array[REGION_SHAPE_HASH_TABLE_SIZE];
+
+    int16_t tiling_piece_mask_array[MAX_NB_OF_REGION_SHAPE_TILINGS];
+    int nb_of_tilings;
+
+} RegionShapeTable;
+
+// read-only after "load_region_shape_table" has been called once
+extern RegionShapeTable region_shape_table;
+
+void load_region_shape_table(void);
+bool can_small_region_be_filled(uint32_t region_mask, int piece_mask);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file savestate.h
+ * @see savestate.c
+ */
+
+#ifndef __SAVESTATE_H__
+#define __SAVESTATE_H__
+
+#include <stdbool.h>
+
+#include <local/piece_data.h> // NB_OF_PIECES
+#include <local/level_data.h> // MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL
+#include <local/board.h>      // Board
+
+// 2 different combinations have at most (nb of open points - 1) starting pieces in common (see savestate.c)
+#define MAX_NB_OF_SAVESTATE_DEPTHS (MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL - 1)
+#define MAX_NB_OF_SAVESTATES_PER_DEPTH 1024
+
+#define NO_PARENT_SAVESTATE -1
+
+/**
+ * @struct Savestate
+ * 1 valid board reached at a depth, as the placement of the piece of this depth + the savestate of the board it was added to (at the previous depth)
+ */
+typedef struct Savestate
+{
+    int parent_savestate_idx;
+    int placement_idx;
+
+} Savestate;
+
+/**
+ * @struct SavestateMemory
+ * All the valid boards reached at the first depths of the last explored combination (1 per solver, see solver_context.h)
+ */
+typedef struct SavestateMemory
+{
+    // depth = index in piece_idx_priority_array of the last added piece
+    int piece_idx_priority_array[MAX_NB_OF_SAVESTATE_DEPTHS]; // pieces the savestates have been recorded with
+    Savestate savestate_array[MAX_NB_OF_SAVESTATE_DEPTHS][MAX_NB_OF_SAVESTATES_PER_DEPTH];
+    int nb_of_savestates_array[MAX_NB_OF_SAVESTATE_DEPTHS];
+    bool is_complete_array[MAX_NB_OF_SAVESTATE_DEPTHS]; // false if there wasn't enough room to record all the valid boards of a depth
+    int nb_of_savestate_depths;                          // depths that are recorded in the current combination
+
+    // ------ Current state of the search
+    int current_savestate_idx_array[MAX_NB_OF_SAVESTATE_DEPTHS]; // savestate of the current board at each depth (parent of the next recorded ones)
+    int similarity_depth;                                        // number of starting pieces the current combination resumes from (0 if it starts from scratch)
+    int loaded_savestate_idx;                                    // savestate (at depth similarity_depth - 1) currently replayed on the board
+
+    // ------ Stats
+    int nb_of_resumed_combinations;
+    int nb_of_loaded_savestates;
+
+} SavestateMemory;
+
+int start_combination_from_savestates(SavestateMemory *savestates, int piece_idx_priority_array[NB_OF_PIECES], int nb_of_open_points);
+void record_savestate(SavestateMemory *savestates, int depth, int placement_idx);
+bool load_next_savestate(SavestateMemory *savestates, Board *board);
+void print_savestate_stats(SavestateMemory *savestates);
+
+#endif
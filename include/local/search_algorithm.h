@@ -11,10 +11,11 @@
 
 #include <stdbool.h>
 
-#include <local/board.h>      // Board
-#include <local/utils.h>      // Vector2_int
-#include <local/piece_data.h> // defines
-#include <local/level_data.h> // defines
+#include <local/board.h>          // Board
+#include <local/solver_context.h> // SolverContext
+#include <local/utils.h>          // Vector2_int
+#include <local/piece_data.h>     // defines
+#include <local/level_data.h>     // defines
 
 #define MAX_NB_OF_COMBINATIONS 70 // There is 8 pieces that have a point, and a maximum "nCr" is obtained with 4 open points per level (nb_of_combinations(set=8,subset=4) = 70)
 
@@ -36,6 +37,9 @@ StartCombinations determine_start_combinations(Board *board);
 void load_combination_data(Board *board, StartCombinations *start_combinations, int combination_idx, int *piece_idx_priority_array, int *nb_of_playable_pieces, bool playable_side_per_piece_idx_mask[][MAX_NB_OF_SIDE_PER_PIECE]);
 bool is_position_already_occupied(Board *board, Vector2_int *base_pos);
 bool is_current_combination_skippable(int current_max_depth, int piece_priority_array[NB_OF_PIECES], int previous_piece_priority_array[NB_OF_PIECES]);
+bool add_piece_to_valid_placement_in_range(Board *board, SolverContext *context, int piece_idx, bool playable_side_mask[MAX_NB_OF_SIDE_PER_PIECE], int first_placement_idx, int last_placement_idx, bool enable_slow_checks);
+bool add_piece_to_next_valid_placement(Board *board, SolverContext *context, int piece_idx, bool playable_side_mask[MAX_NB_OF_SIDE_PER_PIECE], bool is_backtrack_iteration, bool enable_slow_checks);
+void record_combination_failure(SolverContext *context, int current_max_depth, int piece_idx_priority_array[NB_OF_PIECES], int previous_piece_priority_array[NB_OF_PIECES]);
 
 // -----------------------------------------------------------------------------
 
@@ -0,0 +1,68 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file solver_context.h
+ * @see solver_context.c
+ *
+ * Memory used by the checking methods of a solver (see check_board.c and astar.c), that used to be static variables of these functions
+ * Each solve owns its context (and its board), so that multiple solves can run at the same time in one process (on different threads)
+ *
+ * The board itself is still the state of the search, the context is only the work memory of the checks and of the search helpers (see transposition_table.c and savestate.c)
+ */
+
+#ifndef __SOLVER_CONTEXT_H__
+#define __SOLVER_CONTEXT_H__
+
+#include <stdbool.h>
+
+#include <local/utils.h>               // BOARD_WIDTH, BOARD_HEIGHT
+#include <local/piece_data.h>          // Tile and defines
+#include <local/level_data.h>          // MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL
+#include <local/astar.h>               // SimpleTileType, AstarMemory
+#include <local/transposition_table.h> // TranspositionTable
+#include <local/savestate.h>           // SavestateMemory
+
+/**
+ * @struct CheckSettings
+ * Runtime choices of check_board.c > "run_all_checks", so that they can be benchmarked without recompiling (see batch_solver.c)
+ */
+typedef struct CheckSettings
+{
+    bool use_astar_dead_end_check;        // run the previous dead end check (pathfinding, see check_board.c > "check_no_dead_ends_with_astar") instead of the flood fill one
+    int first_disjoint_paths_check_depth; // depths (number of pieces on the board) where the disjoint paths check runs, see check_board.h
+    int last_disjoint_paths_check_depth;
+
+} CheckSettings;
+
+/**
+ * @struct SolverContext
+ */
+typedef struct SolverContext
+{
+    CheckSettings check_settings; // see "get_default_check_settings"
+
+    // ------ check_board.c > "check_no_dead_ends_with_astar" memory (starting and ending points of the pathfinding algorithm)
+    Tile *missing_connection_to_check_array[NB_OF_PIECES * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE + MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL];
+    bool has_already_been_check_matrix[BOARD_WIDTH][BOARD_HEIGHT];
+    SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT]; // see astar.h
+
+    // ------ astar.c > "find_a_path" memory
+    AstarMemory astar_memory;
+
+    // ------ check_board.c > "check_disjoint_paths" profiling counters, per depth (number of pieces on the board)
+    long long disjoint_paths_check_nb_of_calls_array[NB_OF_PIECES + 1];
+    long long disjoint_paths_check_nb_of_cuts_array[NB_OF_PIECES + 1];
+
+    // ------ board states known to have no solution, see transposition_table.c
+    TranspositionTable transposition_table;
+
+    // ------ valid boards of the first depths of the last explored combination, see savestate.c
+    SavestateMemory savestates;
+
+} SolverContext;
+
+CheckSettings get_default_check_settings(void);
+SolverContext *init_solver_context(void);
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file transposition_table.h
+ * @see transposition_table.c
+ */
+
+#ifndef __TRANSPOSITION_TABLE_H__
+#define __TRANSPOSITION_TABLE_H__
+
+#include <stdbool.h>
+#include <stdint.h> // uint64_t
+
+#include <local/utils.h>      // BOARD_TOTAL_NB_TILES, NB_OF_DIRECTIONS
+#include <local/piece_data.h> // NB_OF_PIECES
+
+/**
+ * @struct ZobristKeys
+ * Random keys that are XOR-ed together to make the key of a board (see transposition_table.c)
+ */
+typedef struct ZobristKeys
+{
+    uint64_t normal_tile_key_array[BOARD_TOTAL_NB_TILES][1 << NB_OF_DIRECTIONS]; // by bit index and connection mask (see utils.h > DIRECTION_TO_MASK)
+    uint64_t missing_connection_tile_key_array[BOARD_TOTAL_NB_TILES][NB_OF_DIRECTIONS];
+    uint64_t added_piece_key_array[NB_OF_PIECES];
+    uint64_t combination_piece_key_array[NB_OF_PIECES];
+
+} ZobristKeys;
+
+// read-only after "load_zobrist_keys" has been called once
+extern ZobristKeys zobrist_keys;
+
+#define TRANSPOSITION_TABLE_SIZE (1 << 15) // number of slots, must be a power of 2
+#define EMPTY_TRANSPOSITION_TABLE_SLOT 0
+
+/**
+ * @struct TranspositionTableEntry
+ * 1 board key known to have no solution, and the combination it was recorded in
+ */
+typedef struct TranspositionTableEntry
+{
+    uint64_t dead_board_key;
+    int combination_generation;
+
+} TranspositionTableEntry;
+
+/**
+ * @struct TranspositionTable
+ * Bounded hash set of board keys that are known to have no solution (1 per solver, see solver_context.h)
+ * 1 key per slot, a new key always replaces the old one of its slot
+ */
+typedef struct TranspositionTable
+{
+    TranspositionTableEntry entry_array[TRANSPOSITION_TABLE_SIZE];
+
+    uint64_t combination_key;   // part of the key that depends on the current combination, see "set_transposition_table_combination"
+    int combination_generation; // incremented each time a combination starts
+
+    // ------ Stats
+    long long nb_of_probes;
+    long long nb_of_hits;
+    long long nb_of_records;
+
+    long long nb_of_hits_from_other_combinations;
+    long long nb_of_hits_from_other_combinations_at_combination_start;
+
+} TranspositionTable;
+
+void load_zobrist_keys(void);
+
+void set_transposition_table_combination(TranspositionTable *transposition_table, int piece_idx_priority_array[NB_OF_PIECES], int nb_of_combination_pieces);
+bool has_transposition_table_cut_current_combination(TranspositionTable *transposition_table);
+bool is_board_known_as_dead(TranspositionTable *transposition_table, uint64_t board_key);
+void record_dead_board(TranspositionTable *transposition_table, uint64_t board_key);
+void print_transposition_table_stats(TranspositionTable *transposition_table);
+
+#endif
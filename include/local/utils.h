@@ -11,6 +11,7 @@
 #define __UTILS_H__
 
 #include <stdbool.h>
+#include <stdint.h> // uint32_t
 // --------------------------- Real game related constants -------------------
 
 #define BOARD_WIDTH 8
@@ -31,6 +32,9 @@ typedef int Direction;
 #define LEFT 2
 #define UP 3
 
+// 4-bit encoding of a set of directions (bit d set <=> direction d is in the set), used to store tile connections packed in a single byte
+#define DIRECTION_TO_MASK(direction) (1 << (direction))
+
 Direction reverse_direction(Direction direction);
 
 Direction rotate_direction(Direction direction, int nb_of_clockwise_90_degres_rotation);
@@ -63,8 +67,62 @@ bool is_pos_valid(const Vector2_int *pos);
 // ---- computation with poses
 int manhattan_dist(const Vector2_int *pos1, const Vector2_int *pos2);
 
+// --------------------------- Bitboard stuff --------------------------------------------------
+
+/**
+ * @note The whole board (BOARD_WIDTH * BOARD_HEIGHT = 32 tiles) fits in a single uint32_t
+ * Each tile position (i,j) is mapped to 1 bit, with the same layout as Board::tile_matrix (array of columns) : bit_idx = i * BOARD_HEIGHT + j
+ * So a vertical move (j +/- 1) is a shift of 1 bit, and an horizontal move (i +/- 1) is a shift of BOARD_HEIGHT bits
+ *
+ * These are macros instead of functions, because they are meant to be used in the most called functions of the main algorithm
+ */
+#define FULL_BOARD_MASK ((uint32_t)0xFFFFFFFF)
+#define FIRST_ROW_MASK ((uint32_t)0x11111111) // all tiles with j == 0
+#define LAST_ROW_MASK ((uint32_t)0x88888888)  // all tiles with j == BOARD_HEIGHT - 1
+
+#define POS_TO_BIT_IDX(i, j) ((i) * BOARD_HEIGHT + (j))
+#define POS_TO_BIT_MASK(pos) (((uint32_t)1) << POS_TO_BIT_IDX((pos)->i, (pos)->j))
+#define BIT_IDX_TO_POS(bit_idx, pos)         \
+    do                                       \
+    {                                        \
+        (pos)->i = (bit_idx) / BOARD_HEIGHT; \
+        (pos)->j = (bit_idx) % BOARD_HEIGHT; \
+    } while (0)
+
+// all tiles that are direct neighbours (no diagonal) of at least one tile of the input mask
+// (vertical shifts are masked, so that a bit can't wrap to the next / previous column)
+#define NEIGHBOUR_MASK(mask) ((((mask) << 1) & ~FIRST_ROW_MASK) | (((mask) >> 1) & ~LAST_ROW_MASK) | ((mask) << BOARD_HEIGHT) | ((mask) >> BOARD_HEIGHT))
+
+// bit index of the lowest tile of a non-empty mask (gcc builtin, compiled to a single instruction), to iterate over the tiles of a mask :
+// for (; mask; mask &= mask - 1) { bit_idx = LOWEST_BIT_IDX(mask); ... }
+#define LOWEST_BIT_IDX(mask) __builtin_ctz(mask)
+
+// number of tiles of a mask (gcc builtin as well)
+#define NB_OF_TILES_IN_MASK(mask) __builtin_popcount(mask)
+
+// checkerboard colouring of the board : tile (i,j) is black if i + j is even (BOARD_HEIGHT is even, so it is the same pattern in every column pair)
+#define BLACK_TILE_MASK ((uint32_t)0xA5A5A5A5)
+
+// number of black tiles minus number of white tiles of a mask
+#define COLOUR_IMBALANCE_OF_MASK(mask) (NB_OF_TILES_IN_MASK((mask) & BLACK_TILE_MASK) - NB_OF_TILES_IN_MASK((mask) & ~BLACK_TILE_MASK))
+
+uint32_t get_region_mask(uint32_t seed_mask, uint32_t free_tile_mask);
+
 // --------------------------- Math needed for main search algorithm --------------------------
-int generate_next_combination(const int *input_int_array, int input_array_length, int *next_combination_placeholder, int r);
+
+/**
+ * @struct CombinationGenerator
+ * iteration state of "generate_next_combination", (zero-initialize it before the first call : CombinationGenerator generator = {0};)
+ */
+typedef struct CombinationGenerator
+{
+    int comb[10];
+    int n;
+    bool is_init;
+
+} CombinationGenerator;
+
+int generate_next_combination(CombinationGenerator *generator, const int *input_int_array, int input_array_length, int *next_combination_placeholder, int r);
 
 // -------------------------------
 extern char assets_folder_relative_path[30];
@@ -0,0 +1,288 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file anchor_search.c
+ *
+ * Other branching strategy of the backtracking algorithm (see search_algorithm.c) : the anchor position strategy
+ *
+ * Explanation :
+ *
+ *      The main algorithm adds the pieces in a fixed order (piece_idx_priority_array), and tries every placement of the current piece on the board.
+ *      Most of these placements leave holes that will never be filled, and it takes a few more pieces before the checks notice it.
+ *
+ *      The classic polyomino solvers do it the other way around : in a complete board, every position is covered by exactly 1 piece,
+ *      so the first empty position of the board (the "anchor", first in bit index order, see utils.h > bitboard stuff) has to be covered by one of the remaining pieces.
+ *      At each depth, the algorithm only tries the placements of the remaining pieces that have a normal tile on the anchor,
+ *      they are precomputed for each position (see placement.h > PlacementTable, position -> covering placements index).
+ *      The board is filled column by column, without leaving holes behind.
+ *
+ *      Everything else is the same as the main algorithm :
+ *          - the combinations of point pieces, and the playable sides of each piece (see search_algorithm.c > "load_combination_data")
+ *            (the remaining pieces are tried at the anchor in the order of piece_idx_priority_array)
+ *          - the pre-adding and post-adding checks
+ *          - the transposition table : when no placement fits at the anchor, the board has no solution (see transposition_table.c)
+ *
+ *      The combination skipping trick and the savestates (see savestate.c) rely on the fixed order of the pieces, so they are not used here.
+ *
+ *      It is selectable next to the order based strategy, in batch mode (see batch_solver.c, --engine anchor),
+ *      to compare their valid board counts and times on each level.
+ */
+
+#include <time.h> // clock_gettime, struct timespec
+#include <stdbool.h>
+#include <stdint.h> // uint32_t
+#include <stdio.h>  // printf
+#include <stdlib.h> // malloc, free
+
+#include <raylib/raylib.h> // WindowShouldClose, CloseWindow, BeginDrawing, EndDrawing, ClearBackground
+
+#include <local/utils.h>               // bitboard macros and defines
+#include <local/piece_data.h>          // Piece and defines
+#include <local/level_data.h>          // LevelHints, get_level_hints
+#include <local/board.h>               // Board, init_board, add_placement_to_board, undo_last_piece_adding
+#include <local/placement.h>           // placement_table, load_placement_table
+#include <local/check_board.h>         // run_all_checks
+#include <local/solver_context.h>      // SolverContext, init_solver_context
+#include <local/transposition_table.h> // set_transposition_table_combination, is_board_known_as_dead, record_dead_board
+#include <local/search_algorithm.h>    // StartCombinations, determine_start_combinations, load_combination_data
+#include <local/display.h>             // tile_px_width, and other drawing functions
+
+#include <local/anchor_search.h>
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+static double get_elapsed_seconds(struct timespec *begin, struct timespec *end)
+{
+    return (double)(end->tv_sec - begin->tv_sec) + (double)(end->tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+// Returns the bit index of the first empty position of the board, -1 if the board is full
+static int get_anchor_bit_idx(Board *board)
+{
+    for (int bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+        if (!(board->normal_tile_mask & (((uint32_t)1) << bit_idx)))
+            return bit_idx;
+
+    return -1;
+}
+
+// Function to set the cursors of a new depth, on the current anchor position (the covering cursor is moved to the first placement of each piece when it is tried)
+static void start_depth(AnchorSearchState *state, Board *board, int depth)
+{
+    state->anchor_bit_idx_array[depth] = get_anchor_bit_idx(board);
+    state->piece_rank_array[depth] = 0;
+    state->covering_cursor_array[depth] = 0;
+}
+
+// Function to add one of the remaining pieces to the board, at its next valid placement that covers the anchor position of the depth, starting from the cursors of the depth
+// "valid" meaning that the pre-adding checks (see board.c) and the post-adding checks (see check_board.c) pass
+// Returns true if a piece has been added
+// Returns false if all the covering placements have been tried, the board has then no solution
+static bool add_piece_at_anchor(AnchorSearchState *state, Board *board, SolverContext *context, int depth)
+{
+    int anchor_bit_idx = state->anchor_bit_idx_array[depth];
+    int piece_idx, placement_idx, last_covering_cursor;
+    Placement *placement;
+
+    // the board has an empty position, but no piece left (it can't happen with full pieces, but let's be safe)
+    if (anchor_bit_idx < 0)
+        return false;
+
+    for (; state->piece_rank_array[depth] < state->nb_of_playable_pieces; state->piece_rank_array[depth]++)
+    {
+        piece_idx = state->piece_idx_priority_array[state->piece_rank_array[depth]];
+        if (state->is_piece_added_array[piece_idx])
+            continue;
+
+        if (state->covering_cursor_array[depth] < placement_table.first_covering_placement_idx_array[anchor_bit_idx][piece_idx])
+            state->covering_cursor_array[depth] = placement_table.first_covering_placement_idx_array[anchor_bit_idx][piece_idx];
+        last_covering_cursor = placement_table.first_covering_placement_idx_array[anchor_bit_idx][piece_idx + 1];
+
+        for (; state->covering_cursor_array[depth] < last_covering_cursor; state->covering_cursor_array[depth]++)
+        {
+            placement_idx = placement_table.covering_placement_idx_array[state->covering_cursor_array[depth]];
+            placement = (placement_table.placement_array) + placement_idx;
+
+            // only play forced sides (prievously determined by "load_combination_data")
+            if (!state->playable_side_per_piece_idx_mask[piece_idx][placement->side_idx])
+                continue;
+
+            if (board->normal_tile_mask & placement->tile_mask)
+                continue;
+
+            if (add_placement_to_board(board, placement_idx) != 1)
+                continue;
+
+            if (is_board_known_as_dead(&(context->transposition_table), board->zobrist_key))
+            {
+                undo_last_piece_adding(board);
+                continue;
+            }
+
+            if (run_all_checks(board, context, false) != 1)
+            {
+                undo_last_piece_adding(board);
+                continue;
+            }
+
+            // the cursor is moved past the added placement, for the next time the algorithm backtracks to this depth
+            state->covering_cursor_array[depth]++;
+            state->is_piece_added_array[piece_idx] = true;
+            state->added_piece_idx_array[depth] = piece_idx;
+            return true;
+        }
+
+        // the next piece starts from its first covering placement
+        // (pieces are tried in the order of piece_idx_priority_array, not in the order of the covering placements index)
+        state->covering_cursor_array[depth] = 0;
+    }
+
+    return false;
+}
+
+// Function to explore the tree of the current combination, from the level hints board
+// Returns true if the level has been solved (the solution is left on the board), false if the board is back to the level hints
+static bool explore_combination(AnchorSearchState *state, Board *board, SolverContext *context, int *valid_board_count)
+{
+    // basically the depth at which the algorithm currently is, in the search tree
+    int depth = 0;
+    bool backtrack_iteration = false;
+
+    for (int i = 0; i < NB_OF_PIECES; i++)
+        state->is_piece_added_array[i] = false;
+
+    while (true)
+    {
+        if (depth < 0)
+            return false;
+
+        if (depth == state->nb_of_playable_pieces)
+            return true;
+
+        // if we are currently backtracking, the piece of the depth needs to be removed before the next placements are tried
+        if (backtrack_iteration)
+        {
+            undo_last_piece_adding(board);
+            state->is_piece_added_array[state->added_piece_idx_array[depth]] = false;
+        }
+        else
+            start_depth(state, board, depth);
+
+        if (add_piece_at_anchor(state, board, context, depth))
+        {
+            depth++;
+            (*valid_board_count)++;
+            backtrack_iteration = false;
+            continue;
+        }
+
+        // every placement that covers the anchor has been tried on the current board, and the anchor must be covered
+        // => the current board has no solution
+        record_dead_board(&(context->transposition_table), board->zobrist_key);
+        depth--;
+        backtrack_iteration = true;
+    }
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to solve a level with the anchor position strategy on the calling thread (see this file description)
+// if "solution_board" is not NULL, the solved board is handed over to the caller (to free), NULL if there is no solution
+SolverResult solve_level_with_anchor_cells(int level_num, Board **solution_board)
+{
+    LevelHints *level_hints = get_level_hints(level_num);
+    Board *board;
+    SolverContext *context = init_solver_context();
+    AnchorSearchState *state = malloc(sizeof(AnchorSearchState));
+    StartCombinations start_combinations;
+    SolverResult result = {0};
+    struct timespec begin, end, cpu_time;
+
+    load_placement_table();
+    board = init_board(level_hints);
+    start_combinations = determine_start_combinations(board);
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    for (int combination_idx = 0; combination_idx < start_combinations.nb_of_combinations; combination_idx++)
+    {
+        load_combination_data(board, &start_combinations, combination_idx, state->piece_idx_priority_array, &(state->nb_of_playable_pieces), state->playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), state->piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
+
+        if (explore_combination(state, board, context, &(result.valid_board_count)))
+        {
+            result.solved = true;
+            break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+
+    result.level_num = level_num;
+    result.wall_time = get_elapsed_seconds(&begin, &end);
+    result.cpu_time = (double)cpu_time.tv_sec + (double)cpu_time.tv_nsec / 1e9;
+    result.nb_of_threads = 1;
+    result.node_count_array[0] = result.valid_board_count;
+
+    if (solution_board != NULL)
+        *solution_board = result.solved ? board : NULL;
+    if (solution_board == NULL || !result.solved)
+        free(board);
+
+    free(state);
+    free(context);
+    free(level_hints);
+
+    return result;
+}
+
+// Anchor position counterpart of search_algorithm.c > "run_algorithm_without_display"
+void run_algorithm_with_anchor_cells(int level_num)
+{
+    Board *board;
+    SolverResult result = solve_level_with_anchor_cells(level_num, &board);
+
+#ifndef AUTOMATED_RUNS
+
+    if (result.solved)
+        printf("Solution found!\n");
+    else
+        printf("No solution found...\n");
+    printf("Time : %.3f seconds\n", result.wall_time);
+    printf("Number of valid boards : %d\n", result.valid_board_count);
+
+    // Display only the solution board
+    if (board != NULL)
+    {
+        setup_display((BOARD_WIDTH + 2) * tile_px_width, (BOARD_HEIGHT + 2) * tile_px_width);
+        offset_px.i = 1 * tile_px_width;
+        BoardDrawing *board_drawing = init_board_drawing();
+        update_board_static_drawing(board, board_drawing);
+
+        while (!WindowShouldClose())
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            draw_board(board, board_drawing);
+            draw_level_num(level_num);
+            EndDrawing();
+        }
+
+        CloseWindow();
+        free(board_drawing);
+    }
+
+#else
+    printf("%3d : ", level_num);
+    if (result.solved)
+        printf("solved -> ");
+    else
+        printf("unsolved -> ");
+    printf("%d | %d\n", result.valid_board_count, (int)(result.wall_time * 1000));
+
+#endif
+
+    free(board);
+}
@@ -9,27 +9,18 @@
  * (also, the board actually have multiple valid targets, the pathfinding algorithm will try to go toward the ending target, but if the algorithm ends up on another one, it returns)
  * (returns the final tile or UNDEFINED_TILE (alias for NULL); not the actual path it took to get here)
  *
- * It is needed in check_board.c > "check_no_dead_ends"
+ * It is needed in check_board.c > "check_no_dead_ends_with_astar"
  */
 
 #include <stdlib.h> //malloc and free, NULL
 #include <limits.h> // INT_MAX
 
 #include <local/utils.h>      // Vector2_int, Direction, manhattan_dist, other helper functions, defines
-#include <local/board.h>      // Board, extract_normal_tile_at_pos, UNDEFINED_TILE
+#include <local/board.h>      // Board, UNDEFINED_TILE, extract_normal_tile_at_pos, extract_missing_connection_tile_at_pos
 #include <local/piece_data.h> // Tile
 
 #include <local/astar.h>
 
-typedef struct OpenSetElement
-{
-    int f, h;
-    Vector2_int pos;
-
-    struct OpenSetElement *next;
-
-} OpenSetElement;
-
 static void free_open_set(OpenSetElement *open_set_element)
 {
     // recursive free basically
@@ -51,13 +42,13 @@ Tile *find_a_path_(Board *board, Vector2_int *start_pos, Vector2_int *target_pos
     // the g-scores are stored in a matrix of int
     // h is simply manhattan distance
 
-    static int g_score_matrix[BOARD_WIDTH][BOARD_HEIGHT];
-    static Tile *return_tile;
-    static OpenSetElement *first_open_set_element, *current_open_set_element, *neighbour_element, *temp_open_set_element;
-    static Direction direction;
-    static Vector2_int neighbour_pos;
-    static int temp_g_score;
-    static int i, j;
+    int g_score_matrix[BOARD_WIDTH][BOARD_HEIGHT];
+    Tile *return_tile;
+    OpenSetElement *first_open_set_element, *current_open_set_element, *neighbour_element, *temp_open_set_element;
+    Direction direction;
+    Vector2_int neighbour_pos;
+    int temp_g_score;
+    int i, j;
 
     // g score matrix initialization
     for (i = 0; i < BOARD_WIDTH; i++)
@@ -101,7 +92,9 @@ Tile *find_a_path_(Board *board, Vector2_int *start_pos, Vector2_int *target_pos
             if (board_representation_matrix[neighbour_pos.i][neighbour_pos.j] == target)
             {
                 // we found a path, return the ending tile
-                return_tile = board->tile_matrix[neighbour_pos.i][neighbour_pos.j];
+                return_tile = extract_normal_tile_at_pos(board, &neighbour_pos);
+                if (return_tile == UNDEFINED_TILE)
+                    return_tile = extract_missing_connection_tile_at_pos(board, &neighbour_pos);
                 if (return_tile == UNDEFINED_TILE)
                     // it is actually a level tile
                     return_tile = board->obligatory_tile_matrix[neighbour_pos.i][neighbour_pos.j];
@@ -124,7 +117,7 @@ Tile *find_a_path_(Board *board, Vector2_int *start_pos, Vector2_int *target_pos
             else
             {
                 // we have to determine if the tile is a wall or not (already occupied by a normal tile or not)
-                if (extract_normal_tile_at_pos(board, &neighbour_pos) == UNDEFINED_TILE)
+                if (!(board->normal_tile_mask & POS_TO_BIT_MASK(&neighbour_pos)))
                     // build cache for later
                     board_representation_matrix[neighbour_pos.i][neighbour_pos.j] = clear;
 
@@ -208,12 +201,10 @@ Tile *find_a_path_(Board *board, Vector2_int *start_pos, Vector2_int *target_pos
 // -------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // I'm trying a static memory allocation version
-// which means, that I have to predict the maximum number of tile explored by the algorithm
-
-#define MAX_NB_OF_TILE_TO_EXPLORE BOARD_HEIGHT *BOARD_WIDTH * 10 // assuming the anti-backtrack feature of this algorithm is working, we can only explore each tile 4 times ? + margin to make sure
-// (by doing experiments with the dynamic memory version of this algorithm, I actually found out that it never exceeded BOARD_HEIGHT*BOARD_WIDTH, but BOARD_HEIGHT*BOARD_WIDTH*10 is still a small number, so I'm not taking risks)
+// which means, that I have to predict the maximum number of tile explored by the algorithm (see astar.h > MAX_NB_OF_TILE_TO_EXPLORE)
+// the memory is now given by the caller (see astar.h > AstarMemory), to let multiple solvers run at the same time
 
-Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos, SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT])
+Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos, SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT], AstarMemory *astar_memory)
 {
     // A-star implementation :
     // we need a priority queue for the open_set, I'll not use a heapqueue though, as the open_set is of length n = BOARD_WIDTH*BOARD_HEIGHT maximum, and heapify-up and down operations are a pain to code
@@ -221,17 +212,16 @@ Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos,
     // the g-scores are stored in a matrix of int
     // h is simply manhattan distance
 
-    static int g_score_matrix[BOARD_WIDTH][BOARD_HEIGHT];
-    static Tile *return_tile;
-    static OpenSetElement *first_open_set_element, *current_open_set_element, *neighbour_element, *temp_open_set_element;
-    static Direction direction;
-    static Vector2_int neighbour_pos;
-    static int temp_g_score;
-    static int i, j;
+    int(*g_score_matrix)[BOARD_HEIGHT] = astar_memory->g_score_matrix;
+    OpenSetElement *open_set_element_placeholders = astar_memory->open_set_element_placeholders;
+    Tile *return_tile;
+    OpenSetElement *first_open_set_element, *current_open_set_element, *neighbour_element, *temp_open_set_element;
+    Direction direction;
+    Vector2_int neighbour_pos;
+    int temp_g_score;
+    int i, j;
 
-    // static memory emplacements
-    static OpenSetElement open_set_element_placeholders[MAX_NB_OF_TILE_TO_EXPLORE];
-    static int nb_of_placeholders;
+    int nb_of_placeholders;
 
     // replacing all malloc calls by &(open_set_element_placeholders[nb_of_placeholders]); nb_of_placeholders++;
     // and getting rid of the free calls
@@ -280,7 +270,9 @@ Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos,
             if (board_representation_matrix[neighbour_pos.i][neighbour_pos.j] == target)
             {
                 // we found a path, return the ending tile
-                return_tile = board->tile_matrix[neighbour_pos.i][neighbour_pos.j];
+                return_tile = extract_normal_tile_at_pos(board, &neighbour_pos);
+                if (return_tile == UNDEFINED_TILE)
+                    return_tile = extract_missing_connection_tile_at_pos(board, &neighbour_pos);
                 if (return_tile == UNDEFINED_TILE)
                     // it is actually a level tile
                     return_tile = board->obligatory_tile_matrix[neighbour_pos.i][neighbour_pos.j];
@@ -301,7 +293,7 @@ Tile *find_a_path(Board *board, Vector2_int *start_pos, Vector2_int *target_pos,
             else
             {
                 // we have to determine if the tile is a wall or not (already occupied by a normal tile or not)
-                if (extract_normal_tile_at_pos(board, &neighbour_pos) == UNDEFINED_TILE)
+                if (!(board->normal_tile_mask & POS_TO_BIT_MASK(&neighbour_pos)))
                     // build cache for later
                     board_representation_matrix[neighbour_pos.i][neighbour_pos.j] = clear;
 
@@ -0,0 +1,513 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file batch_solver.c
+ *
+ * Headless mode to solve a list of levels on a fixed-size pool of threads, and record the results in a CSV or JSON file
+ *
+ * Usage : main.exe --batch <level list> [-j <nb of threads>] [--split-depth <depth>] [-o <output path>] [--engine backtracking|dlx|anchor|mrv|astar]
+ *                   [--disjoint-paths-depths <first depth>-<last depth>]
+ *
+ *      - level list : comma separated levels or level ranges, ex : "49-72,97,100-120"
+ *      - nb of threads : size of the thread pool (DEFAULT_NB_OF_SOLVER_THREADS by default)
+ *      - split depth : (backtracking and astar engines only) solve the levels one after the other instead, each of them on all the threads,
+ *        with this split depth (see parallel_search.c, 0 to only explore combinations in parallel), ex : --batch 97 -j 8 --split-depth 4
+ *      - output path : results are written in JSON if it ends with ".json", in CSV otherwise (DEFAULT_BATCH_OUTPUT_PATH by default)
+ *      - engine : search algorithm used to solve each level (backtracking by default, see search_algorithm.c, dlx_solver.c, anchor_search.c and mrv_search.c)
+ *        astar is the backtracking engine with the previous dead end check (pathfinding, see check_board.c > "check_no_dead_ends_with_astar") instead of the flood fill one
+ *      - disjoint paths depths : (backtracking and astar engines only) depths where the disjoint paths check runs (see check_board.h, FIRST_DISJOINT_PATHS_CHECK_DEPTH by default),
+ *        ex : --disjoint-paths-depths 0-10 to run it everywhere, and read its cuts / calls per depth printed at the end of the batch
+ *
+ * Each thread of the pool takes the next unsolved level of the list and solves it on its own (see parallel_search.c, with 1 thread and no splitting),
+ * so the whole batch takes about as long as its slowest level, as long as there are enough threads.
+ * With a split depth, it is the other way around : the threads share the work of 1 level at a time (useful to solve a single hard level faster).
+ * The results are always written in the order of the list, whatever order the levels are solved in.
+ * Each result also has the valid boards and the steals of each thread that solved the level (see SolverResult),
+ * to see how well the work of a level is shared with a given split depth (CSV : space separated in 1 column, JSON : arrays).
+ *
+ * Usage : main.exe --compare-engines [level list] [--engine dlx|anchor|mrv|astar]
+ *
+ *      Solves each level (49-120 by default) with the backtracking engine and the other engine (dlx by default), one after the other,
+ *      and prints their valid board counts and times, and whether they found the same solution.
+ *      (with --engine astar, it is the benchmark of both dead end checks on each level)
+ */
+
+#include <time.h> // clock_gettime, struct timespec
+#include <stdbool.h>
+#include <stdio.h>     // printf, fprintf, fopen, fclose
+#include <stdlib.h>    // strtol, free
+#include <string.h>    // strcmp, strlen
+#include <pthread.h>   // pthread_t, pthread_create, pthread_join
+#include <stdatomic.h> // atomic_int and functions
+
+#include <local/utils.h>           // BOARD_WIDTH, BOARD_HEIGHT
+#include <local/board.h>           // Board, extract_normal_tile_at_pos, get_tile_connection_mask
+#include <local/placement.h>       // load_placement_table
+#include <local/parallel_search.h> // SolverResult, solve_level_in_parallel, and defines
+#include <local/solver_context.h>  // CheckSettings, get_default_check_settings
+#include <local/dlx_solver.h>      // solve_level_with_dlx
+#include <local/anchor_search.h>   // solve_level_with_anchor_cells
+#include <local/mrv_search.h>      // solve_level_with_mrv
+
+#include <local/batch_solver.h>
+
+static const char *engine_name_array[NB_OF_ENGINES] = {"backtracking", "dlx", "anchor", "mrv", "astar"};
+
+/**
+ * @struct BatchData
+ * Data shared by the thread pool
+ */
+typedef struct BatchData
+{
+    int *level_num_array;         // read-only
+    int nb_of_levels;             // read-only
+    SolverResult *result_array;   // each result is only written by the thread that solves its level
+    SolverEngine engine;          // read-only
+    CheckSettings check_settings; // read-only
+    atomic_int next_level_idx;    // next level to hand out
+
+} BatchData;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// Function to read a level number at the start of "str", and move "str" after it
+// Returns INVALID_LEVEL_LIST if there is no number or if the level is not implemented
+static int read_level_num(const char **str)
+{
+    char *end;
+    long level_num = strtol(*str, &end, 10);
+
+    if (end == *str || level_num < FIRST_SOLVABLE_LEVEL || level_num > LAST_SOLVABLE_LEVEL)
+        return INVALID_LEVEL_LIST;
+
+    *str = end;
+    return (int)level_num;
+}
+
+static bool is_json_path(const char *output_path)
+{
+    size_t length = strlen(output_path);
+    return length >= 5 && strcmp(output_path + length - 5, ".json") == 0;
+}
+
+// Function to write the per thread stats of a result ("count_array" of SolverResult), ex : "12 40 3" in CSV, "[12, 40, 3]" in JSON
+static void write_thread_counts(FILE *output_file, const int count_array[], int nb_of_threads, bool is_json)
+{
+    if (is_json)
+        fprintf(output_file, "[");
+    for (int thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+        fprintf(output_file, "%s%d", (thread_idx == 0) ? "" : (is_json ? ", " : " "), count_array[thread_idx]);
+    if (is_json)
+        fprintf(output_file, "]");
+}
+
+// Function to read the depths of the disjoint paths check, ex : "5-7" or "6" (see check_board.h)
+// Returns true if "depths_str" is a valid range of depths in [0, NB_OF_PIECES]
+static bool parse_disjoint_paths_depths(const char *depths_str, CheckSettings *check_settings)
+{
+    char *end;
+    long first_depth = strtol(depths_str, &end, 10);
+    long last_depth = first_depth;
+
+    if (end == depths_str)
+        return false;
+    if (*end == '-')
+    {
+        depths_str = end + 1;
+        last_depth = strtol(depths_str, &end, 10);
+        if (end == depths_str)
+            return false;
+    }
+    if (*end != '\0' || first_depth < 0 || last_depth > NB_OF_PIECES || first_depth > last_depth)
+        return false;
+
+    check_settings->first_disjoint_paths_check_depth = (int)first_depth;
+    check_settings->last_disjoint_paths_check_depth = (int)last_depth;
+    return true;
+}
+
+// Function to print the cuts / calls of the disjoint paths check per depth, summed over all the levels (like check_board.c > "print_disjoint_paths_check_stats")
+// to see at which depths it pays off (see check_board.h)
+static void print_disjoint_paths_check_totals(SolverResult result_array[], int nb_of_levels)
+{
+    long long nb_of_calls, nb_of_cuts;
+
+    printf("disjoint paths cuts / calls per depth :");
+    for (int depth = 0; depth <= NB_OF_PIECES; depth++)
+    {
+        nb_of_calls = 0;
+        nb_of_cuts = 0;
+        for (int level_idx = 0; level_idx < nb_of_levels; level_idx++)
+        {
+            nb_of_calls += result_array[level_idx].disjoint_paths_check_nb_of_calls_array[depth];
+            nb_of_cuts += result_array[level_idx].disjoint_paths_check_nb_of_cuts_array[depth];
+        }
+        printf(" %lld/%lld", nb_of_cuts, nb_of_calls);
+    }
+    printf("\n");
+}
+
+// Returns the engine named "engine_name" (see engine_name_array), or INVALID_ENGINE
+static int parse_engine_name(const char *engine_name)
+{
+    for (int engine = 0; engine < NB_OF_ENGINES; engine++)
+        if (strcmp(engine_name, engine_name_array[engine]) == 0)
+            return engine;
+
+    return INVALID_ENGINE;
+}
+
+// Function to solve 1 level with 1 engine on the calling thread ("check_settings" are only used by the backtracking and astar engines)
+static SolverResult solve_level_with_engine(SolverEngine engine, int level_num, CheckSettings check_settings, Board **solution_board)
+{
+    switch (engine)
+    {
+    case DLX_ENGINE:
+        return solve_level_with_dlx(level_num, solution_board);
+    case ANCHOR_ENGINE:
+        return solve_level_with_anchor_cells(level_num, solution_board);
+    case MRV_ENGINE:
+        return solve_level_with_mrv(level_num, solution_board);
+    case ASTAR_ENGINE:
+        check_settings.use_astar_dead_end_check = true;
+        return solve_level_in_parallel(level_num, 1, 0, check_settings, solution_board);
+    default:
+        return solve_level_in_parallel(level_num, 1, 0, check_settings, solution_board);
+    }
+}
+
+static void *batch_thread_main(void *arg)
+{
+    BatchData *batch_data = arg;
+    int level_idx;
+
+    while ((level_idx = atomic_fetch_add(&(batch_data->next_level_idx), 1)) < batch_data->nb_of_levels)
+        batch_data->result_array[level_idx] = solve_level_with_engine(batch_data->engine, batch_data->level_num_array[level_idx], batch_data->check_settings, NULL);
+
+    return NULL;
+}
+
+// Returns true if both boards have the same tile type and connections at each position
+// (2 different sets of placements can draw the same solution, ex : with the symmetric sides of the SQUARE piece)
+static bool are_solutions_the_same(Board *board_1, Board *board_2)
+{
+    Tile *tile_1, *tile_2;
+    Vector2_int pos;
+
+    for (pos.i = 0; pos.i < BOARD_WIDTH; pos.i++)
+    {
+        for (pos.j = 0; pos.j < BOARD_HEIGHT; pos.j++)
+        {
+            tile_1 = extract_normal_tile_at_pos(board_1, &pos);
+            tile_2 = extract_normal_tile_at_pos(board_2, &pos);
+            if (tile_1 == NULL || tile_2 == NULL)
+            {
+                if (tile_1 != tile_2)
+                    return false;
+                continue;
+            }
+            if (tile_1->tile_type != tile_2->tile_type || get_tile_connection_mask(tile_1) != get_tile_connection_mask(tile_2))
+                return false;
+        }
+    }
+    return true;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to parse a level list, ex : "49-72,97,100-120"
+// Returns the number of levels loaded in "level_num_array", or INVALID_LEVEL_LIST
+int parse_level_list(const char *level_list_str, int level_num_array[MAX_NB_OF_BATCH_LEVELS])
+{
+    const char *str = level_list_str;
+    int nb_of_levels = 0;
+    int first_level_num, last_level_num;
+
+    while (true)
+    {
+        first_level_num = read_level_num(&str);
+        if (first_level_num == INVALID_LEVEL_LIST)
+            return INVALID_LEVEL_LIST;
+
+        last_level_num = first_level_num;
+        if (*str == '-')
+        {
+            str++;
+            last_level_num = read_level_num(&str);
+            if (last_level_num == INVALID_LEVEL_LIST || last_level_num < first_level_num)
+                return INVALID_LEVEL_LIST;
+        }
+
+        for (int level_num = first_level_num; level_num <= last_level_num; level_num++)
+        {
+            if (nb_of_levels == MAX_NB_OF_BATCH_LEVELS)
+                return INVALID_LEVEL_LIST;
+            level_num_array[nb_of_levels] = level_num;
+            nb_of_levels++;
+        }
+
+        if (*str == '\0')
+            return nb_of_levels;
+        if (*str != ',')
+            return INVALID_LEVEL_LIST;
+        str++;
+    }
+}
+
+// Function to solve all the levels of "level_num_array" on "nb_of_threads" threads
+// with ONE_THREAD_PER_LEVEL as "split_depth", each thread solves its own levels, otherwise all the threads solve 1 level at a time with this split depth (backtracking and astar engines only)
+// "result_array" is filled in the same order as "level_num_array"
+void solve_levels_in_batch(int level_num_array[], int nb_of_levels, int nb_of_threads, int split_depth, SolverEngine engine, CheckSettings check_settings, SolverResult result_array[])
+{
+    BatchData batch_data;
+    pthread_t thread_array[MAX_NB_OF_SOLVER_THREADS];
+    int thread_idx;
+
+    if (nb_of_threads > MAX_NB_OF_SOLVER_THREADS)
+        nb_of_threads = MAX_NB_OF_SOLVER_THREADS;
+    if (nb_of_threads < 1)
+        nb_of_threads = 1;
+
+    // shared read-only data, must be computed before threads start
+    load_placement_table();
+
+    if (split_depth != ONE_THREAD_PER_LEVEL)
+    {
+        check_settings.use_astar_dead_end_check = (engine == ASTAR_ENGINE);
+        for (int level_idx = 0; level_idx < nb_of_levels; level_idx++)
+            result_array[level_idx] = solve_level_in_parallel(level_num_array[level_idx], nb_of_threads, split_depth, check_settings, NULL);
+        return;
+    }
+
+    if (nb_of_threads > nb_of_levels)
+        nb_of_threads = nb_of_levels;
+
+    batch_data.level_num_array = level_num_array;
+    batch_data.nb_of_levels = nb_of_levels;
+    batch_data.result_array = result_array;
+    batch_data.engine = engine;
+    batch_data.check_settings = check_settings;
+    atomic_init(&(batch_data.next_level_idx), 0);
+
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+        pthread_create(thread_array + thread_idx, NULL, batch_thread_main, &batch_data);
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+        pthread_join(thread_array[thread_idx], NULL);
+}
+
+// Function to write the results to "output_path" (JSON if it ends with ".json", CSV otherwise)
+// Returns 1 if the file has been written, CANT_OPEN_OUTPUT_FILE otherwise
+int write_batch_results(SolverResult result_array[], int nb_of_levels, const char *output_path)
+{
+    FILE *output_file = fopen(output_path, "w");
+    SolverResult *result;
+    bool is_json = is_json_path(output_path);
+
+    if (output_file == NULL)
+        return CANT_OPEN_OUTPUT_FILE;
+
+    if (is_json)
+        fprintf(output_file, "[\n");
+    else
+        fprintf(output_file, "level_num,solved,valid_board_count,wall_time_ms,cpu_time_ms,nb_of_threads,thread_valid_board_counts,thread_steal_counts\n");
+
+    for (int level_idx = 0; level_idx < nb_of_levels; level_idx++)
+    {
+        result = result_array + level_idx;
+        if (is_json)
+        {
+            fprintf(output_file, "  {\"level_num\": %d, \"solved\": %s, \"valid_board_count\": %d, \"wall_time_ms\": %.3f, \"cpu_time_ms\": %.3f, \"nb_of_threads\": %d, \"thread_valid_board_counts\": ",
+                    result->level_num, result->solved ? "true" : "false", result->valid_board_count, result->wall_time * 1000, result->cpu_time * 1000, result->nb_of_threads);
+            write_thread_counts(output_file, result->node_count_array, result->nb_of_threads, is_json);
+            fprintf(output_file, ", \"thread_steal_counts\": ");
+            write_thread_counts(output_file, result->steal_count_array, result->nb_of_threads, is_json);
+            fprintf(output_file, "}%s\n", (level_idx == nb_of_levels - 1) ? "" : ",");
+        }
+        else
+        {
+            fprintf(output_file, "%d,%d,%d,%.3f,%.3f,%d,",
+                    result->level_num, result->solved, result->valid_board_count, result->wall_time * 1000, result->cpu_time * 1000, result->nb_of_threads);
+            write_thread_counts(output_file, result->node_count_array, result->nb_of_threads, is_json);
+            fprintf(output_file, ",");
+            write_thread_counts(output_file, result->steal_count_array, result->nb_of_threads, is_json);
+            fprintf(output_file, "\n");
+        }
+    }
+
+    if (is_json)
+        fprintf(output_file, "]\n");
+
+    fclose(output_file);
+    return 1;
+}
+
+// Entry point of the batch mode from the command line arguments (see this file description)
+// Returns 1 if everything went fine, else an error code
+int run_batch_mode(int argc, char *argv[])
+{
+    int level_num_array[MAX_NB_OF_BATCH_LEVELS];
+    SolverResult result_array[MAX_NB_OF_BATCH_LEVELS];
+    int nb_of_levels = INVALID_LEVEL_LIST;
+    int nb_of_threads = DEFAULT_NB_OF_SOLVER_THREADS;
+    int split_depth = ONE_THREAD_PER_LEVEL;
+    const char *output_path = DEFAULT_BATCH_OUTPUT_PATH;
+    SolverEngine engine = BACKTRACKING_ENGINE;
+    CheckSettings check_settings = get_default_check_settings();
+    bool has_check_settings = false;
+    int nb_of_solved_levels = 0;
+    struct timespec begin, end;
+    char *end_of_number;
+    int return_value;
+
+    for (int arg_idx = 1; arg_idx < argc; arg_idx++)
+    {
+        if (strcmp(argv[arg_idx], "--batch") == 0 && arg_idx + 1 < argc)
+            nb_of_levels = parse_level_list(argv[++arg_idx], level_num_array);
+        else if (strcmp(argv[arg_idx], "-j") == 0 && arg_idx + 1 < argc)
+            nb_of_threads = (int)strtol(argv[++arg_idx], NULL, 10);
+        else if (strcmp(argv[arg_idx], "--split-depth") == 0 && arg_idx + 1 < argc)
+        {
+            arg_idx++;
+            split_depth = (int)strtol(argv[arg_idx], &end_of_number, 10);
+            if (end_of_number == argv[arg_idx] || *end_of_number != '\0' || split_depth < 0)
+            {
+                printf("Invalid split depth : %s, expected a number >= 0\n", argv[arg_idx]);
+                return INVALID_SPLIT_DEPTH;
+            }
+        }
+        else if (strcmp(argv[arg_idx], "--disjoint-paths-depths") == 0 && arg_idx + 1 < argc)
+        {
+            arg_idx++;
+            if (!parse_disjoint_paths_depths(argv[arg_idx], &check_settings))
+            {
+                printf("Invalid disjoint paths depths : %s, expected <first depth>-<last depth> between 0 and %d, ex : 5-7\n", argv[arg_idx], NB_OF_PIECES);
+                return INVALID_DISJOINT_PATHS_DEPTHS;
+            }
+            has_check_settings = true;
+        }
+        else if (strcmp(argv[arg_idx], "-o") == 0 && arg_idx + 1 < argc)
+            output_path = argv[++arg_idx];
+        else if (strcmp(argv[arg_idx], "--engine") == 0 && arg_idx + 1 < argc)
+        {
+            arg_idx++;
+            if (parse_engine_name(argv[arg_idx]) == INVALID_ENGINE)
+            {
+                printf("Invalid engine : %s, expected backtracking, dlx, anchor, mrv or astar\n", argv[arg_idx]);
+                return INVALID_ENGINE;
+            }
+            engine = parse_engine_name(argv[arg_idx]);
+        }
+    }
+
+    if (nb_of_levels == INVALID_LEVEL_LIST)
+    {
+        printf("Invalid level list, expected levels between %d and %d, ex : --batch 49-72,97,100-120\n", FIRST_SOLVABLE_LEVEL, LAST_SOLVABLE_LEVEL);
+        return INVALID_LEVEL_LIST;
+    }
+
+    // the other engines only run on 1 thread, they can't share a level between threads
+    if (split_depth != ONE_THREAD_PER_LEVEL && engine != BACKTRACKING_ENGINE && engine != ASTAR_ENGINE)
+    {
+        printf("Invalid engine : %s, only the backtracking and astar engines can use a split depth\n", engine_name_array[engine]);
+        return INVALID_ENGINE;
+    }
+    if (has_check_settings && engine != BACKTRACKING_ENGINE && engine != ASTAR_ENGINE)
+    {
+        printf("Invalid engine : %s, only the backtracking and astar engines can use disjoint paths depths\n", engine_name_array[engine]);
+        return INVALID_ENGINE;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    solve_levels_in_batch(level_num_array, nb_of_levels, nb_of_threads, split_depth, engine, check_settings, result_array);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    for (int level_idx = 0; level_idx < nb_of_levels; level_idx++)
+        if (result_array[level_idx].solved)
+            nb_of_solved_levels++;
+
+    printf("%d / %d levels solved in %.3f seconds\n", nb_of_solved_levels, nb_of_levels, (double)(end.tv_sec - begin.tv_sec) + (double)(end.tv_nsec - begin.tv_nsec) / 1e9);
+    if (engine == BACKTRACKING_ENGINE || engine == ASTAR_ENGINE)
+        print_disjoint_paths_check_totals(result_array, nb_of_levels);
+
+    return_value = write_batch_results(result_array, nb_of_levels, output_path);
+    if (return_value == CANT_OPEN_OUTPUT_FILE)
+        printf("Can't open output file : %s\n", output_path);
+    else
+        printf("Results written to : %s\n", output_path);
+
+    return return_value;
+}
+
+// Entry point of the engine comparison mode from the command line arguments (see this file description)
+// Returns 1 if both engines found the same solutions, else an error code
+int run_engine_comparison_mode(int argc, char *argv[])
+{
+    int level_num_array[MAX_NB_OF_BATCH_LEVELS];
+    const char *level_list_str = "49-120";
+    int nb_of_levels;
+    SolverEngine other_engine = DLX_ENGINE;
+    SolverResult backtracking_result, other_result;
+    Board *backtracking_board, *other_board;
+    bool are_the_same;
+    int nb_of_disagreements = 0;
+    long long total_backtracking_count = 0, total_other_count = 0;
+    double total_backtracking_time = 0, total_other_time = 0;
+
+    for (int arg_idx = 2; arg_idx < argc; arg_idx++)
+    {
+        if (strcmp(argv[arg_idx], "--engine") == 0 && arg_idx + 1 < argc)
+        {
+            arg_idx++;
+            if (parse_engine_name(argv[arg_idx]) == INVALID_ENGINE || parse_engine_name(argv[arg_idx]) == BACKTRACKING_ENGINE)
+            {
+                printf("Invalid engine : %s, expected dlx, anchor, mrv or astar\n", argv[arg_idx]);
+                return INVALID_ENGINE;
+            }
+            other_engine = parse_engine_name(argv[arg_idx]);
+        }
+        else
+            level_list_str = argv[arg_idx];
+    }
+
+    nb_of_levels = parse_level_list(level_list_str, level_num_array);
+    if (nb_of_levels == INVALID_LEVEL_LIST)
+    {
+        printf("Invalid level list, expected levels between %d and %d, ex : --compare-engines 49-72,97,100-120\n", FIRST_SOLVABLE_LEVEL, LAST_SOLVABLE_LEVEL);
+        return INVALID_LEVEL_LIST;
+    }
+
+    load_placement_table();
+
+    printf("level | backtracking : boards, ms | %s : boards, ms | same solution\n", engine_name_array[other_engine]);
+
+    for (int level_idx = 0; level_idx < nb_of_levels; level_idx++)
+    {
+        backtracking_board = NULL;
+        other_board = NULL;
+        backtracking_result = solve_level_with_engine(BACKTRACKING_ENGINE, level_num_array[level_idx], get_default_check_settings(), &backtracking_board);
+        other_result = solve_level_with_engine(other_engine, level_num_array[level_idx], get_default_check_settings(), &other_board);
+
+        are_the_same = (backtracking_result.solved == other_result.solved);
+        if (are_the_same && backtracking_result.solved)
+            are_the_same = are_solutions_the_same(backtracking_board, other_board);
+        if (!are_the_same)
+            nb_of_disagreements++;
+
+        printf("%5d | %8d %8.3f | %8d %8.3f | %s\n", level_num_array[level_idx],
+               backtracking_result.valid_board_count, backtracking_result.wall_time * 1000,
+               other_result.valid_board_count, other_result.wall_time * 1000, are_the_same ? "yes" : "NO");
+
+        total_backtracking_count += backtracking_result.valid_board_count;
+        total_other_count += other_result.valid_board_count;
+        total_backtracking_time += backtracking_result.wall_time;
+        total_other_time += other_result.wall_time;
+
+        free(backtracking_board);
+        free(other_board);
+    }
+
+    printf("total | %8lld %8.3f | %8lld %8.3f | %d disagreement(s)\n", total_backtracking_count, total_backtracking_time * 1000, total_other_count, total_other_time * 1000, nb_of_disagreements);
+
+    return (nb_of_disagreements == 0) ? 1 : ENGINES_DISAGREE;
+}
@@ -12,13 +12,15 @@
  *
  * It will be used by the main search algorithm, that will automatically add and remove pieces from a board according to what we are trying to solve.
  */
-#include <stdlib.h> // malloc and free, NULL, abs
+#include <stdlib.h> // malloc and free, NULL
 #include <stdbool.h>
+#include <stdio.h> // printf
 
-#include <local/utils.h>      // Vector2_int, Direction, helper functions and defines
-#include <local/piece_data.h> // Tile, Side, Piece, load_piece_array, and defines
-#include <local/level_data.h> // LevelHints, PieceAddInfos
-#include <local/piece.h>      // defines
+#include <local/utils.h>               // Vector2_int, Direction, helper functions and defines
+#include <local/piece_data.h>          // Tile, Side, Piece, load_piece_array, and defines
+#include <local/level_data.h>          // LevelHints, PieceAddInfos
+#include <local/placement.h>           // Placement, placement_table, load_placement_table, get_placement_idx
+#include <local/transposition_table.h> // zobrist_keys
 
 #include <local/board.h>
 
@@ -29,8 +31,8 @@
 // function to initialize pieces current position data fields
 static void set_all_board_pieces_pos_to_zero(Board *board)
 {
-    static int piece_idx;
-    static Piece *piece;
+    int piece_idx;
+    Piece *piece;
 
     for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
     {
@@ -39,12 +41,71 @@ static void set_all_board_pieces_pos_to_zero(Board *board)
         piece->current_side_idx = 0;
         piece->current_base_pos = (Vector2_int){0, 0};
         piece->current_rotation_state = 0;
+        piece->current_placement_idx = UNDEFINED_PLACEMENT_IDX;
     }
 }
 
+// level placements of the boards without level hints (see "init_board")
+static LevelPlacements no_level_hints_placements = {.is_loaded = false};
+
+// level placements of a board until its own are ready (see "init_board"), no placement is a level placement so "can_placement_be_added_to_board" takes no shortcut
+static const LevelPlacements empty_level_placements = {.is_loaded = false};
+
+// Function to list the placements of the pieces that aren't level pieces, that pass the pre-adding checks on the level hints board (see level_data.h > LevelPlacements)
+// It is only called once per level : every piece that is added afterwards only restricts the board more, so the other placements can never pass them again
+static void load_level_placements(Board *board, LevelPlacements *level_placements)
+{
+    bool is_level_piece_array[NB_OF_PIECES] = {false};
+    int piece_idx, side_idx, placement_idx;
+
+    for (int i = 0; i < board->nb_of_added_pieces; i++)
+        is_level_piece_array[board->added_piece_idx_array[i]] = true;
+
+    // (the board still points to empty_level_placements while they are checked, see "init_board")
+    for (int word_idx = 0; word_idx < NB_OF_LEVEL_PLACEMENT_WORDS; word_idx++)
+        level_placements->level_placement_bitset[word_idx] = 0;
+
+    level_placements->nb_of_level_placements = 0;
+    level_placements->nb_of_non_level_piece_placements = 0;
+
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        for (side_idx = 0; side_idx < MAX_NB_OF_SIDE_PER_PIECE; side_idx++)
+        {
+            level_placements->first_level_placement_idx_array[piece_idx][side_idx] = level_placements->nb_of_level_placements;
+            if (is_level_piece_array[piece_idx])
+                continue;
+
+            level_placements->nb_of_non_level_piece_placements += placement_table.first_placement_idx_array[piece_idx][side_idx + 1] - placement_table.first_placement_idx_array[piece_idx][side_idx];
+
+            for (placement_idx = placement_table.first_placement_idx_array[piece_idx][side_idx]; placement_idx < placement_table.first_placement_idx_array[piece_idx][side_idx + 1]; placement_idx++)
+            {
+                if (can_placement_idx_be_added_to_board(board, placement_idx) != 1)
+                    continue;
+
+                level_placements->level_placement_idx_array[level_placements->nb_of_level_placements] = placement_idx;
+                level_placements->nb_of_level_placements++;
+            }
+        }
+        level_placements->first_level_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE] = level_placements->nb_of_level_placements;
+    }
+
+    for (int i = 0; i < level_placements->nb_of_level_placements; i++)
+    {
+        placement_idx = level_placements->level_placement_idx_array[i];
+        level_placements->level_placement_bitset[placement_idx >> 6] |= ((uint64_t)1) << (placement_idx & 63);
+    }
+
+    level_placements->is_loaded = true;
+}
+
 Board *init_board(LevelHints *level_hints)
 {
     Board *board = malloc(sizeof(Board));
+    LevelPlacements *level_placements;
+
+    // 0) the placement table is shared by all boards, and only computed the first time
+    load_placement_table();
 
     // 1) Basic data init
     board->nb_of_added_pieces = 0;
@@ -55,15 +116,40 @@ Board *init_board(LevelHints *level_hints)
     board->has_T_piece_been_added = false;
     board->has_line2_2_been_added = false;
 
-    // 2) Set every tile pointer to UNDEFINED_TILE (NULL pointer)
+    // 1 ter) empty bitboards
+    board->normal_tile_mask = 0;
+    board->missing_connection_tile_mask = 0;
+    board->double_missing_connection_tile_mask = 0;
+    board->zobrist_key = 0;
+
+    // 1 septies) no level placement yet, the level pieces of step 4) are checked like any other adding
+    board->level_placements = &empty_level_placements;
+
+    // 1 quater) the whole board is 1 empty region, without any endpoint
+    board->empty_region_mask_array[0] = FULL_BOARD_MASK;
+    board->nb_of_empty_regions = 1;
+    for (int bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+        board->empty_region_idx_array[bit_idx] = 0;
+    board->obligatory_point_tile_mask = 0;
+    board->open_endpoint_tile_mask = 0;
+
+    // 1 sexies) no tile type hint
+    board->has_full_tile_type_hints = false;
+    for (int tile_type = 0; tile_type < NB_OF_NORMAL_TILE_TYPES; tile_type++)
+        board->obligatory_tile_type_mask_array[tile_type] = 0;
+
+    // 1 quinquies) no path on the board
+    board->path_partner_journal_length = 0;
+    board->nb_of_loops = 0;
+
+    // 2) Empty cells, and set every obligatory tile pointer to UNDEFINED_TILE (NULL pointer)
+    for (int bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+        board->cell_array[bit_idx] = (BoardCell){.piece_idx = NO_PIECE};
+
     for (int i = 0; i < BOARD_WIDTH; i++)
     {
         for (int j = 0; j < BOARD_HEIGHT; j++)
-        {
-
-            board->tile_matrix[i][j] = UNDEFINED_TILE;
             board->obligatory_tile_matrix[i][j] = UNDEFINED_TILE;
-        }
     }
 
     // 3) Get all game pieces informations and their live data cache (loading piece_array)
@@ -76,31 +162,11 @@ Board *init_board(LevelHints *level_hints)
     // so the "first previous position" needs to be set
     set_all_board_pieces_pos_to_zero(board);
 
-    // 4) set stop end of stacks in tile matrix (implemented like linked lists)
-    int piece_idx;
-    Piece *piece;
-    int side_idx;
-    Side *side;
-    int tile_idx;
+    // 3.75) every side is playable until a combination says otherwise
+    for (int piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        board->playable_side_mask_array[piece_idx] = (1 << board->piece_array[piece_idx].nb_of_sides) - 1;
 
-    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
-    {
-        piece = (board->piece_array) + piece_idx;
-
-        for (side_idx = 0; side_idx < piece->nb_of_sides; side_idx++)
-        {
-
-            side = (piece->side_array) + side_idx;
-
-            for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
-                side->tile_array[tile_idx].next = UNDEFINED_TILE;
-
-            for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
-                side->missing_connection_tile_array[tile_idx].next = UNDEFINED_TILE;
-        }
-    }
-
-    // 5) Load level hints (add obligatory pieces and load obligatory tile matrix)
+    // 4) Load level hints (add obligatory pieces and load obligatory tile matrix)
     board->obligatory_tile_array = NULL;
     board->nb_of_obligatory_tiles = 0;
 
@@ -114,7 +180,16 @@ Board *init_board(LevelHints *level_hints)
         {
             current_tile = (level_hints->obligatory_tile_array) + i;
             board->obligatory_tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j] = current_tile;
+            current_tile->connection_mask = 0;
+            for (int connection_idx = 0; connection_idx < current_tile->nb_of_connections; connection_idx++)
+                current_tile->connection_mask |= DIRECTION_TO_MASK(current_tile->connection_direction_array[connection_idx]);
+            if (current_tile->tile_type == point)
+                board->obligatory_point_tile_mask |= POS_TO_BIT_MASK(&(current_tile->absolute_pos));
+            if (current_tile->tile_type < NB_OF_NORMAL_TILE_TYPES)
+                board->obligatory_tile_type_mask_array[current_tile->tile_type] |= POS_TO_BIT_MASK(&(current_tile->absolute_pos));
         }
+        board->has_full_tile_type_hints = ((board->obligatory_tile_type_mask_array[point] | board->obligatory_tile_type_mask_array[line] |
+                                            board->obligatory_tile_type_mask_array[bend] | board->obligatory_tile_type_mask_array[empty]) == FULL_BOARD_MASK);
 
         PieceAddInfos *piece_add_infos = NULL;
         for (int i = 0; i < level_hints->nb_of_obligatory_pieces; i++)
@@ -130,152 +205,145 @@ Board *init_board(LevelHints *level_hints)
 
     board->nb_of_level_pieces = board->nb_of_added_pieces;
 
+    // 5) placements that fit on the level hints board (once the level pieces are added), only computed by the first board of the level
+    // (boards without level hints all share the same ones, like the placement table, they are computed the first time)
+    level_placements = (level_hints != NULL) ? &(level_hints->level_placements) : &no_level_hints_placements;
+    if (!level_placements->is_loaded)
+        load_level_placements(board, level_placements);
+    board->level_placements = level_placements;
+
     return board;
 }
 
+// Function to find where a piece side should start going through its level placements, to continue from "placement_idx" (see search_algorithm.c > "add_piece_to_valid_placement_in_range")
+// Returns the position k of its first level placement >= placement_idx (k in [first_level_placement_idx_array[piece_idx][side_idx], first_level_placement_idx_array[piece_idx][side_idx + 1]])
+int get_first_level_placement_pos(Board *board, int piece_idx, int side_idx, int placement_idx)
+{
+    int low = board->level_placements->first_level_placement_idx_array[piece_idx][side_idx];
+    int high = board->level_placements->first_level_placement_idx_array[piece_idx][side_idx + 1];
+    int middle;
+
+    // binary search, the level placements of a side are sorted
+    while (low < high)
+    {
+        middle = (low + high) / 2;
+        if (board->level_placements->level_placement_idx_array[middle] < placement_idx)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+// Function to print how much the level hints shrink the search space (number of level placements out of all the placements of the pieces that aren't level pieces)
+void print_level_placement_stats(Board *board)
+{
+    printf("level placements : %d / %d", board->level_placements->nb_of_level_placements, board->level_placements->nb_of_non_level_piece_placements);
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------- Pre adding check function ------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 // -------------- Helper functions and macros ----------------------------------------------------------------------------------------------
 
-// helper function to check if a tile respect the obligatory tile matrix which is the data of level hints
-// see can_piece_be_added_to_board
-static bool is_tile_matching_level_hints(Tile *current_tile, Tile *obligatory_tile)
+// helper function to get the 4-bit connection mask of a live tile (see utils.h > DIRECTION_TO_MASK)
+// (it is kept up to date with Tile::connection_direction_array, by "add_placement_to_board", piece.c > "blit_piece_main_data", and "init_board" for level hints)
+uint8_t get_tile_connection_mask(Tile *tile)
 {
-    static int connection_i, connection_j;
-    static Direction direction_searched_for = 0;
-    static bool direction_found = false;
+    return tile->connection_mask;
+}
 
+// helper function to check if a tile respect the obligatory tile matrix which is the data of level hints
+// the tile to check is given by its type and its connection mask (see placement.h)
+// see can_placement_be_added_to_board
+static bool is_tile_matching_level_hints(TileType tile_type, uint8_t connection_mask, Tile *obligatory_tile)
+{
     if (obligatory_tile == UNDEFINED_TILE)
     {
-        if (current_tile->tile_type == point)
+        if (tile_type == point)
             return false; // Exception where points can't exist without obligatory point tile underneath, (in the game rules we can't add extra points)
 
         return true; // Case where there's no obligatory data on this position
     }
 
-    if (current_tile->tile_type != obligatory_tile->tile_type)
+    if (tile_type != obligatory_tile->tile_type)
         return false; // If their type is not matching, neither their connection directions
 
     if (obligatory_tile->tile_type == point)
         return true; // In this particular case, we don't check for connection directions (level open points don't have obligatory connection direction)
 
-    // Connection directions matching check
-    for (connection_i = 0; connection_i < obligatory_tile->nb_of_connections; connection_i++)
-    {
-        direction_searched_for = obligatory_tile->connection_direction_array[connection_i];
-        direction_found = false;
-        for (connection_j = 0; connection_j < current_tile->nb_of_connections; connection_j++)
-        {
-            if (current_tile->connection_direction_array[connection_j] == direction_searched_for)
-            {
-                direction_found = true;
-                break;
-            }
-        }
-        if (!direction_found)
-            return false;
-    }
+    // Connection directions matching check : the tile must have all the connections of the obligatory tile
     // There might be a false positive case where current_tile have more connections than obligatory_tile
     // but with current datas, it can't happen
-
-    return true;
+    return (connection_mask & obligatory_tile->connection_mask) == obligatory_tile->connection_mask;
 }
 
 // helper function to check if a normal tile connection directions fulfill the corresponding missing_connection tile ones
-// see can_piece_be_added_to_board
-static bool is_tile_matching_missing_connections(Tile *normal_tile, Tile *missing_connection_tile_stack)
+// the normal tile is given by its connection mask, and the missing connection tiles of the position by the OR of their connection masks (see BoardCell::missing_connection_mask)
+// see can_placement_be_added_to_board
+static bool is_tile_matching_missing_connections(uint8_t normal_tile_connection_mask, uint8_t missing_connection_mask)
 {
+    // the normal tile must have the connection of each missing connection tile of the position
+    return (normal_tile_connection_mask & missing_connection_mask) == missing_connection_mask;
+}
 
-    // normal_tile is supposedly not a stack, just a single tile
-    // missing_connection_tile_stack could be a single tile or a tile stack (but there are guaranteed only missing_connection tiles in this stack)
-    // regarding both use cases of this function in "can_piece_be_added_to_board"
-
-    static int connection_idx;
-    static Direction direction_searched_for;
-    static bool direction_found;
-
-    static Tile *temp_tile = NULL;
-
-    temp_tile = missing_connection_tile_stack;
-
-    while (temp_tile != UNDEFINED_TILE)
-    {
-        direction_searched_for = temp_tile->connection_direction_array[0];
-        direction_found = false;
-        for (connection_idx = 0; connection_idx < normal_tile->nb_of_connections; connection_idx++)
-        {
-            if (normal_tile->connection_direction_array[connection_idx] == direction_searched_for)
-            {
-                direction_found = true;
-                break;
-            }
-        }
-        // we must have direction_found == true at each iteration of while loop for the whole function to return true
-        if (!direction_found)
-            return false;
+// function that returns a tile pointer on the normal tile at base_pos (i,j) on the board
+// if there is any, and returns UNDEFINED_TILE if not found
+Tile *extract_normal_tile_at_pos(Board *board, Vector2_int *base_pos)
+{
+    BoardCell *cell = (board->cell_array) + POS_TO_BIT_IDX(base_pos->i, base_pos->j);
+    Piece *piece;
 
-        temp_tile = temp_tile->next;
-    }
+    if (cell->piece_idx == NO_PIECE)
+        return UNDEFINED_TILE;
 
-    return true;
+    piece = (board->piece_array) + cell->piece_idx;
+    return (piece->side_array[piece->current_side_idx].tile_array) + cell->tile_idx;
 }
 
-// Returns a pointer to a normal tile in the input stack (linked list) of tiles
-// Returns UNDEFINED_TILE if not found
-Tile *extract_normal_tile_from_stack(Tile *tile_stack)
+// Returns the missing connection tile of an added piece, from its index in Board::path_partner_idx_array (see piece_data.h > Tile::path_end_idx)
+Tile *get_path_end_tile(Board *board, int path_end_idx)
 {
-    static Tile *temp_tile = NULL;
-    temp_tile = tile_stack;
-    while (temp_tile != UNDEFINED_TILE)
-    {
-        if (temp_tile->tile_type != missing_connection)
-            return temp_tile;
+    Piece *piece = (board->piece_array) + (path_end_idx / MAX_NB_OF_MISSING_CONNECTION_PER_SIDE);
 
-        temp_tile = temp_tile->next;
-    }
-    return UNDEFINED_TILE;
+    return (piece->side_array[piece->current_side_idx].missing_connection_tile_array) + (path_end_idx % MAX_NB_OF_MISSING_CONNECTION_PER_SIDE);
 }
 
-// function that returns a tile pointer on the normal tile at base_pos (i,j) on the board
+// function that returns a tile pointer on a missing connection tile at base_pos (i,j) on the board (the one with the lowest direction if there are 2)
 // if there is any, and returns UNDEFINED_TILE if not found
-Tile *extract_normal_tile_at_pos(Board *board, Vector2_int *base_pos)
+Tile *extract_missing_connection_tile_at_pos(Board *board, Vector2_int *base_pos)
 {
-    return extract_normal_tile_from_stack(board->tile_matrix[base_pos->i][base_pos->j]);
-}
+    BoardCell *cell = (board->cell_array) + POS_TO_BIT_IDX(base_pos->i, base_pos->j);
 
-// Function to count the number of missing connection tiles in the tile stack
-// (stack implemented as a linked list, see piece_data.h > Tile struct)
-int get_number_of_missing_connection_in_stack(Tile *tile_stack)
-{
-    static int nb;
-    static Tile *temp_tile = NULL;
+    if (cell->nb_of_missing_connections == 0)
+        return UNDEFINED_TILE;
 
-    nb = 0;
-    temp_tile = tile_stack;
+    return get_path_end_tile(board, cell->path_end_idx_array[LOWEST_BIT_IDX(cell->missing_connection_mask)]);
+}
 
-    while (temp_tile != UNDEFINED_TILE)
-    {
-        if (temp_tile->tile_type == missing_connection)
-            nb++;
+// Function to XOR the keys of all missing connection tiles of a position into the board key (see transposition_table.c)
+// (it adds them if they weren't part of it, and removes them if they were)
+static void toggle_missing_connection_tiles_in_board_key(Board *board, int bit_idx)
+{
+    uint8_t missing_connection_mask;
 
-        temp_tile = temp_tile->next;
-    }
-    return nb;
+    for (missing_connection_mask = board->cell_array[bit_idx].missing_connection_mask; missing_connection_mask; missing_connection_mask &= missing_connection_mask - 1)
+        board->zobrist_key ^= zobrist_keys.missing_connection_tile_key_array[bit_idx][LOWEST_BIT_IDX(missing_connection_mask)];
 }
 
 // -------------- Main function --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-// Function to check if a piece can be added to the board while blitting its live data cache which will be used to add it
+// Function to check if a placement of a piece (see placement.h) can be added to the board
 //  A piece can be added to the board if all of the below checks pass :
 //  To every normal tile of the blitted piece :
-//  - tile is not outside the board
+//  - tile is not outside the board (always true, placements outside the board don't exist in the placement table)
 //  - tile is not superposed to existing normal tile on the board
 //  - if it is superposed to an existing missing_connection_tile / double missing connection tile: does the connection of the normal tile fulfill the missing connection(s)
 //  - if this tile emplacement is in the level hints (i.e. not UNDEFINED_TILE), check if the tile_type is the same (always) + connections are the same (only if the tile is not a point)
 // To every missing connection tile of the blitted piece :
-// - tile is not outside the board
+// - tile is not outside the board (same as above)
 // - if tile is superposed to an existing normal tile -> does the connection of the normal tile fulfill the missing connection
 // - tile can be superposed to another existing missing connection tile to form a double missing connection tile, if and only if special pieces containing the corresponding double connection has not been played
 // (only line2 2 has a tile that can fulfill a double missing connection in a line and only T piece has tile that can fulfill a double missing connection in a bend)
@@ -284,71 +352,68 @@ int get_number_of_missing_connection_in_stack(Tile *tile_stack)
 // The function discard all computations as soon as it has been detected that the piece doesn't fit and returns an error code > see board.h
 // else returns 1 (true)
 // Let the more likely error cases be check in first to make the whole thing faster
-// (It doesn't matter if garbage / incomplete data is left in the piece cache, as only piece cache that had been through this function will be used in the rest of the program)
-static int can_piece_be_added_to_board(Board *board, int piece_idx, Side *side, Vector2_int base_pos, int rotation_state)
+// (Tile positions and connections are read from the placement, the piece live data is only written by "add_placement_to_board" once this check passed)
+static int can_placement_be_added_to_board(Board *board, Side *side, const Placement *placement)
 {
-    static Tile *current_tile = NULL;
-    static Tile *existing_tile_stack = NULL;
-    static Tile *existing_normal_tile = NULL;
-    static Tile *obligatory_tile = NULL;
-    static int tile_idx;
-    static int connection_idx;
-    static bool is_line_shape;
+    BoardCell *existing_cell = NULL;
+    Tile *obligatory_tile = NULL;
+    int tile_idx;
+    Direction direction;
+    bool is_line_shape, is_matching_level_hints;
+    uint8_t connection_mask;
+    uint32_t pos_bit_mask;
+    Vector2_int pos;
+
+    // Normal tiles superposed to existing normal tiles are the most likely error case, and it is now only one AND for the whole piece
+    if (placement->tile_mask & board->normal_tile_mask)
+        return SUPERPOSED_TILES;
 
     // We only want to update non temp_* variables if the whole check pass, and that we actually want to add this piece after this check
     // That is why we used sort of proxy variables here
     board->temp_bend_double_missing_connection_position = board->bend_double_missing_connection_position;
     board->temp_line_double_missing_connection_position = board->line_double_missing_connection_position;
 
-    // Missing connection tiles are checked in first, as there are usually less of them in game pieces
-    // Less checks to be done to them compared to normal tiles
-    // and they are more likely to be blitted out of bounds in the first place
-
     // ----------------------------------------------------------
     // ------ Missing connection tiles checks -------------------
     // ----------------------------------------------------------
-    for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
-    {
-        current_tile = (side->missing_connection_tile_array) + tile_idx;
-
-        tile_absolute_pos_computation(); // see piece.h
 
-        // checks done to absolute postion of the tile
-        if (!is_pos_inside_board(&(current_tile->absolute_pos)))
-            return OUT_OF_BOUNDS;
+    // only those which are superposed to something on the board need further checks
+    if (placement->missing_connection_tile_mask & (board->normal_tile_mask | board->missing_connection_tile_mask))
+    {
+        for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+        {
+            pos_bit_mask = ((uint32_t)1) << placement->missing_connection_tile_bit_idx_array[tile_idx];
 
-        // connection directions are needed for all further checks
-        tile_connection_directions_computation(); // see piece.h
+            if (!(pos_bit_mask & (board->normal_tile_mask | board->missing_connection_tile_mask)))
+                continue; // case where the board is free at this position, there's no further checks
 
-        existing_tile_stack = board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j];
+            BIT_IDX_TO_POS(placement->missing_connection_tile_bit_idx_array[tile_idx], &pos);
+            existing_cell = (board->cell_array) + placement->missing_connection_tile_bit_idx_array[tile_idx];
+            direction = placement->missing_connection_tile_direction_array[tile_idx];
 
-        if (existing_tile_stack == UNDEFINED_TILE)
-            continue; // case where the board is free at this position, there's no further checks
+            // is there already a normal tile in the existing cell ?
+            if (pos_bit_mask & board->normal_tile_mask)
+            {
+                // Case where a normal tile already exist at this position on the board
+                // does it fulfill missing connections of current_tile ?
+                if (!(existing_cell->normal_connection_mask & DIRECTION_TO_MASK(direction)))
+                    return TILE_NOT_MATCHING_MISSING_CONNECTIONS;
 
-        // is there already a normal tile in the existing tile ?
-        existing_normal_tile = extract_normal_tile_from_stack(existing_tile_stack);
-        if (existing_normal_tile != UNDEFINED_TILE)
-        {
+                continue;
+            }
 
-            // Case where a normal tile already exist at this position on the board
-            // does it fulfill missing connections of current_tile ?
-            if (!is_tile_matching_missing_connections(existing_normal_tile, current_tile))
-                return TILE_NOT_MATCHING_MISSING_CONNECTIONS;
-        }
-        else
-        {
-            // case where 2 missing connection tiles are about to be superposed (reminder : existing_tile_stack != UNDEFINED_TILE here)
+            // case where 2 missing connection tiles are about to be superposed (reminder : the existing cell has a missing connection tile here)
             // there are multiple cases to be considered
 
             // the existing tile could already be a double missing connection tile, a triple missing connection tile can't exist in vanilla game setup
-            if (existing_tile_stack->next != UNDEFINED_TILE)
+            if (pos_bit_mask & board->double_missing_connection_tile_mask)
                 return TRIPLE_MISSING_CONNECTION_TILE;
 
             // Assuming the directions of missing connections are different, do their sum is a bend-shape or a line-shape
             // only 2 case where the shape formed by the 2 directions can be a line : (RIGHT:0,LEFT:2) (means horizontal line) and (DOWN:1,UP:3) (means vertical line)
             // otherwise it's a bend shape
-            // this computation check if there is an absolute difference of 2 between the two directions, if there is -> this is a line
-            is_line_shape = (abs((current_tile->connection_direction_array[0]) - (existing_tile_stack->connection_direction_array[0]))) == 2;
+            connection_mask = existing_cell->missing_connection_mask | DIRECTION_TO_MASK(direction);
+            is_line_shape = (connection_mask == (DIRECTION_TO_MASK(RIGHT) | DIRECTION_TO_MASK(LEFT))) || (connection_mask == (DIRECTION_TO_MASK(DOWN) | DIRECTION_TO_MASK(UP)));
 
             if (is_line_shape)
             {
@@ -362,7 +427,7 @@ static int can_piece_be_added_to_board(Board *board, int piece_idx, Side *side,
                     return INVALID_DOUBLE_MISSING_CONNECTION;
 
                 // Record it, if everything above is ok
-                board->temp_line_double_missing_connection_position = current_tile->absolute_pos;
+                board->temp_line_double_missing_connection_position = pos;
             }
             else // it is bend shape then
             {
@@ -375,7 +440,7 @@ static int can_piece_be_added_to_board(Board *board, int piece_idx, Side *side,
                     return INVALID_DOUBLE_MISSING_CONNECTION;
 
                 // Record it, if everything above is ok
-                board->temp_bend_double_missing_connection_position = current_tile->absolute_pos;
+                board->temp_bend_double_missing_connection_position = pos;
             }
         }
     }
@@ -383,64 +448,50 @@ static int can_piece_be_added_to_board(Board *board, int piece_idx, Side *side,
     // ----------------------------------------------
     // ------ Normal tiles checks -------------------
     // ----------------------------------------------
-    for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+
+    // the tiles of a level placement are already known to match the level hints (see "load_level_placements"), so only the missing connections on the board are left to check
+    is_matching_level_hints = IS_LEVEL_PLACEMENT(board->level_placements, placement - placement_table.placement_array);
+    if (!is_matching_level_hints || (placement->tile_mask & board->missing_connection_tile_mask))
     {
-        current_tile = (side->tile_array) + tile_idx;
+        for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+        {
+            BIT_IDX_TO_POS(placement->tile_bit_idx_array[tile_idx], &pos);
 
-        tile_absolute_pos_computation();
+            if (board->missing_connection_tile_mask & (((uint32_t)1) << placement->tile_bit_idx_array[tile_idx]))
+            {
+                // If we are here, it means that the current tile is about to be superposed to an existing missing connection tile
+                // does it match ?
+                if (!is_tile_matching_missing_connections(placement->tile_connection_mask_array[tile_idx], board->cell_array[placement->tile_bit_idx_array[tile_idx]].missing_connection_mask))
+                    return TILE_NOT_MATCHING_MISSING_CONNECTIONS;
+            }
 
-        // checks done to absolute postion of the tile
-        if (!is_pos_inside_board(&(current_tile->absolute_pos)))
-            return OUT_OF_BOUNDS;
+            if (is_matching_level_hints)
+                continue;
 
-        // checks done to absolute position of the tile with extra information if there is already an existing tile at this position
-        existing_tile_stack = board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j];
+            // Check if the tile match level hints
+            obligatory_tile = board->obligatory_tile_matrix[pos.i][pos.j];
 
-        if (existing_tile_stack == UNDEFINED_TILE)
-        {
-            // In this case, there's no further comparaison to existing tile as the tile in the board is free
-            // but its connection directions still need to be computed
-            tile_connection_directions_computation();
+            if (!is_tile_matching_level_hints(side->tile_array[tile_idx].tile_type, placement->tile_connection_mask_array[tile_idx], obligatory_tile))
+                return TILE_NOT_MATCHING_LEVEL_HINTS;
         }
-        else
-        {
-            if (extract_normal_tile_from_stack(existing_tile_stack) != UNDEFINED_TILE)
-                // Case where a tile already exist at this position on the board and superposition of two normal tiles is not allowed
-                // we don't need to have computed connection directions to check this
-                return SUPERPOSED_TILES;
-
-            // tile connection direction change computation needed for further checking
-            tile_connection_directions_computation();
-
-            // If we are here, it means that the current tile is about to be superposed to an existing missing connection tile
-            // does it match ?
-            if (!is_tile_matching_missing_connections(current_tile, existing_tile_stack))
-                return TILE_NOT_MATCHING_MISSING_CONNECTIONS;
-        }
-
-        // Check if the tile match level hints
-        obligatory_tile = board->obligatory_tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j];
-
-        if (!is_tile_matching_level_hints(current_tile, obligatory_tile))
-            return TILE_NOT_MATCHING_LEVEL_HINTS;
     }
 
     // check if the normal tiles that would be added fill double missing connection tiles and flag them
     // this is only possible if we are trying to add certain piece
-    switch (piece_idx)
+    switch (placement->piece_idx)
     {
     case LINE2_2:
 
-        current_tile = side->tile_array + LINE_DOUBLE_FILLING_TILE_IDX;
-        if (are_pos_equal(&(current_tile->absolute_pos), &(board->temp_line_double_missing_connection_position)))
+        BIT_IDX_TO_POS(placement->tile_bit_idx_array[LINE_DOUBLE_FILLING_TILE_IDX], &pos);
+        if (are_pos_equal(&pos, &(board->temp_line_double_missing_connection_position)))
             set_invalid_pos(&(board->temp_line_double_missing_connection_position));
 
         break;
 
     case T_PIECE:
 
-        current_tile = side->tile_array + BEND_DOUBLE_FILLING_TILE_IDX;
-        if (are_pos_equal(&(current_tile->absolute_pos), &(board->temp_bend_double_missing_connection_position)))
+        BIT_IDX_TO_POS(placement->tile_bit_idx_array[BEND_DOUBLE_FILLING_TILE_IDX], &pos);
+        if (are_pos_equal(&pos, &(board->temp_bend_double_missing_connection_position)))
             set_invalid_pos(&(board->temp_bend_double_missing_connection_position));
 
         break;
@@ -452,30 +503,213 @@ static int can_piece_be_added_to_board(Board *board, int piece_idx, Side *side,
     return true;
 }
 
+// -------------- Empty regions helper functions ------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Function to set the region index of all the tiles of a region mask
+static void label_empty_region(Board *board, uint32_t region_mask, int region_idx)
+{
+    for (; region_mask; region_mask &= region_mask - 1)
+        board->empty_region_idx_array[LOWEST_BIT_IDX(region_mask)] = region_idx;
+}
+
+// Function to update the empty regions of the board, when a placement is added (see board.h > Board::empty_region_mask_array)
+// The tiles of a piece are connected and empty before the adding, so they are all in the same region, and the other regions don't change
+// This region loses the tiles of the piece and may be cut in several parts, they are found with a flood fill restricted to the region (see utils.c > "get_region_mask") :
+// the first part keeps the region index, the other ones are appended at the end of the array
+// The split is recorded in the undo log, at the index of the piece in added_piece_idx_array
+static void split_empty_region(Board *board, const Placement *placement)
+{
+    EmptyRegionSplit *split = (board->empty_region_split_array) + board->nb_of_added_pieces;
+    uint32_t remaining_tile_mask, border_tile_mask, region_part_mask, previous_region_part_mask;
+    int region_idx;
+
+    split->region_idx = board->empty_region_idx_array[placement->tile_bit_idx_array[0]];
+    split->region_mask = board->empty_region_mask_array[split->region_idx];
+    split->nb_of_new_regions = 0;
+
+    remaining_tile_mask = split->region_mask & ~(placement->tile_mask);
+    board->empty_region_mask_array[split->region_idx] = remaining_tile_mask;
+
+    // Most of the time, the piece doesn't cut the region :
+    // every tile of the region that is left was connected to the piece, so it is still connected to 1 of the empty border tiles of the piece
+    // so if these border tiles are still connected to each other, the region is in 1 part, and the flood fill can stop there
+    // (it takes a few steps, the border tiles being all around the piece)
+    border_tile_mask = placement->border_tile_mask & remaining_tile_mask;
+    region_part_mask = border_tile_mask & (~border_tile_mask + 1); // lowest bit
+    previous_region_part_mask = 0;
+
+    while ((region_part_mask & border_tile_mask) != border_tile_mask)
+    {
+        if (region_part_mask == previous_region_part_mask)
+            break;
+
+        previous_region_part_mask = region_part_mask;
+        region_part_mask = (region_part_mask | NEIGHBOUR_MASK(region_part_mask)) & remaining_tile_mask;
+    }
+
+    if ((region_part_mask & border_tile_mask) == border_tile_mask)
+        return;
+
+    // The region is cut, the flood fill is finished, and the other parts grow from the border tiles that haven't been reached
+    region_part_mask = get_region_mask(region_part_mask, remaining_tile_mask);
+    board->empty_region_mask_array[split->region_idx] = region_part_mask; // tiles are already labelled with this index
+    border_tile_mask &= ~region_part_mask;
+
+    while (border_tile_mask)
+    {
+        region_part_mask = get_region_mask(border_tile_mask & (~border_tile_mask + 1), remaining_tile_mask);
+        border_tile_mask &= ~region_part_mask;
+
+        region_idx = board->nb_of_empty_regions;
+        board->empty_region_mask_array[region_idx] = region_part_mask;
+        label_empty_region(board, region_part_mask, region_idx);
+        board->nb_of_empty_regions++;
+        split->nb_of_new_regions++;
+    }
+}
+
+// Reverse operation of "split_empty_region", with the last entry of the undo log (nb_of_added_pieces has already been decremented)
+static void merge_empty_region(Board *board)
+{
+    EmptyRegionSplit *split = (board->empty_region_split_array) + board->nb_of_added_pieces;
+
+    // only the tiles of the new regions need to be labelled again (the ones of the piece have kept the region index, labelling them again doesn't matter)
+    if (split->nb_of_new_regions > 0)
+        label_empty_region(board, split->region_mask & ~(board->empty_region_mask_array[split->region_idx]), split->region_idx);
+
+    board->empty_region_mask_array[split->region_idx] = split->region_mask;
+    board->nb_of_empty_regions -= split->nb_of_new_regions;
+}
+
+// Function to update the tiles where a future path has to end, after any change of the bitboards :
+// - the open missing connection tiles (not filled yet by normal tiles)
+//   except the double missing connection tiles (the path linking them is necessary a single tile, it's like a trivial case)
+//   and the ones on a point tile of the level (same thing, the point tile is the end of the path)
+// - the point tiles of the level that are still open (not filled, even by a missing connection tile, as it is then already taken into account)
+static void update_open_endpoint_tile_mask(Board *board)
+{
+    uint32_t single_missing_connection_tile_mask = board->missing_connection_tile_mask & ~(board->double_missing_connection_tile_mask);
+
+    board->open_endpoint_tile_mask = ((single_missing_connection_tile_mask & ~(board->obligatory_point_tile_mask)) |
+                                      (board->obligatory_point_tile_mask & ~(board->missing_connection_tile_mask))) &
+                                     ~(board->normal_tile_mask);
+}
+
+// -------------- Paths helper functions ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Function to change the partner of a path end, the previous one is kept in the journal for "undo_last_piece_adding"
+static void set_path_partner(Board *board, int path_end_idx, int partner_idx)
+{
+    PathPartnerChange *change = (board->path_partner_journal) + board->path_partner_journal_length;
+
+    change->path_end_idx = path_end_idx;
+    change->previous_partner_idx = board->path_partner_idx_array[path_end_idx];
+    board->path_partner_idx_array[path_end_idx] = partner_idx;
+    board->path_partner_journal_length++;
+}
+
+// Function to link 2 path ends that face each other (they are filled by each other's normal tiles)
+// Their 2 paths become 1, whose ends are the other ends of the 2 paths
+// If the 2 ends are already the 2 ends of the same path, it is a loop
+static void link_path_ends(Board *board, PathJoins *joins, int path_end_idx, int other_path_end_idx)
+{
+    int partner_idx = board->path_partner_idx_array[path_end_idx];
+    int other_partner_idx = board->path_partner_idx_array[other_path_end_idx];
+
+    if (partner_idx == other_path_end_idx)
+    {
+        joins->nb_of_new_loops++;
+        board->nb_of_loops++;
+        return;
+    }
+
+    if (partner_idx != NO_PATH_END)
+        set_path_partner(board, partner_idx, other_partner_idx);
+    if (other_partner_idx != NO_PATH_END)
+        set_path_partner(board, other_partner_idx, partner_idx);
+}
+
+// Function to update the path partners of the board, when a piece is added (its tiles must already be on the board stacks)
+// 1) the ends of the piece are linked to each other inside the piece (see piece_data.c > "load_path_partners")
+// 2) each missing connection tile of the piece that is on a normal tile of the board, faces a missing connection tile of another piece, which is on a normal tile of the piece
+//    (the pre-adding checks make sure that the connections match), the 2 paths are linked
+//    (only the missing connection tiles of the added piece are looked at, so that each link is done once)
+static void join_paths_of_added_piece(Board *board, Side *side, uint32_t previous_normal_tile_mask)
+{
+    PathJoins *joins = (board->path_joins_array) + board->nb_of_added_pieces;
+    Tile *missing_connection_tile;
+    Vector2_int facing_pos;
+    Direction facing_direction;
+    int tile_idx, partner_tile_idx;
+
+    joins->first_change_idx = board->path_partner_journal_length;
+    joins->nb_of_new_loops = 0;
+
+    // 1) (the piece is not on the board, so its ends don't need to be in the journal)
+    for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+    {
+        partner_tile_idx = side->path_partner_missing_connection_tile_idx_array[tile_idx];
+        board->path_partner_idx_array[side->missing_connection_tile_array[tile_idx].path_end_idx] = (partner_tile_idx == NO_PATH_END) ? NO_PATH_END : side->missing_connection_tile_array[partner_tile_idx].path_end_idx;
+    }
+
+    // 2)
+    for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+    {
+        missing_connection_tile = (side->missing_connection_tile_array) + tile_idx;
+        if (!(previous_normal_tile_mask & POS_TO_BIT_MASK(&(missing_connection_tile->absolute_pos))))
+            continue;
+
+        // the facing missing connection tile is on the normal tile of the piece, and points back to the missing connection tile
+        facing_pos = missing_connection_tile->absolute_pos;
+        increment_pos_in_direction(&facing_pos, missing_connection_tile->connection_direction_array[0]);
+        facing_direction = reverse_direction(missing_connection_tile->connection_direction_array[0]);
+
+        link_path_ends(board, joins, missing_connection_tile->path_end_idx, board->cell_array[POS_TO_BIT_IDX(facing_pos.i, facing_pos.j)].path_end_idx_array[facing_direction]);
+    }
+}
+
+// Reverse operation of "join_paths_of_added_piece", with the last entry of the undo log (nb_of_added_pieces has already been decremented)
+static void split_paths_of_removed_piece(Board *board)
+{
+    PathJoins *joins = (board->path_joins_array) + board->nb_of_added_pieces;
+    PathPartnerChange *change;
+
+    while (board->path_partner_journal_length > joins->first_change_idx)
+    {
+        board->path_partner_journal_length--;
+        change = (board->path_partner_journal) + board->path_partner_journal_length;
+        board->path_partner_idx_array[change->path_end_idx] = change->previous_partner_idx;
+    }
+
+    board->nb_of_loops -= joins->nb_of_new_loops;
+}
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------- adding and removing functions ------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-// Function to blit a piece to the board
-// Returns error code if the piece doesn't fit at all (by checking "can_piece_be_added_to_board"), see board.h
+// Function to blit a piece to the board, at a placement of the placement table (see placement.h)
+// Returns error code if the piece doesn't fit at all (by checking "can_placement_be_added_to_board"), see board.h
 // In this case, it doesn't do anything
-// The error code returned is the same as "can_piece_be_added_to_board"
+// The error code returned is the same as "can_placement_be_added_to_board"
 // Returns true (1) if the piece has been successfully added
-int add_piece_to_board(Board *board, int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state)
+int add_placement_to_board(Board *board, int placement_idx)
 {
-    static int error_code;
+    int error_code;
 
-    static Piece *piece = NULL;
-    static Side *side = NULL;
-    static Tile *current_tile = NULL;
-    static Tile *existing_tile_stack = NULL;
-    static int tile_idx = 0;
+    const Placement *placement = NULL;
+    Piece *piece = NULL;
+    Side *side = NULL;
+    Tile *current_tile = NULL;
+    BoardCell *cell = NULL;
+    int tile_idx = 0;
+    int connection_idx = 0;
 
-    piece = (board->piece_array) + piece_idx;
-    side = (piece->side_array) + side_idx;
+    placement = (placement_table.placement_array) + placement_idx;
+    piece = (board->piece_array) + placement->piece_idx;
+    side = (piece->side_array) + placement->side_idx;
 
-    // check if the piece can even fit in the board while blitting it by the same occasion (see piece.c > blit_piece_main_data)
-    error_code = can_piece_be_added_to_board(board, piece_idx, side, base_pos, rotation_state);
+    error_code = can_placement_be_added_to_board(board, side, placement);
     if (error_code != true) // to confirm only the case where 1 is returned
         return error_code;
 
@@ -483,33 +717,66 @@ int add_piece_to_board(Board *board, int piece_idx, int side_idx, Vector2_int ba
     for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
     {
         current_tile = side->tile_array + tile_idx;
-        existing_tile_stack = board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j];
-        // we don't even need to check existing tile, to see if the superposition is allowed, as it has already been done in "can_piece_be_added_to_board"
+
+        // blit of the live data of the tile (see piece.c > "blit_piece_main_data"), copied from the placement
+        BIT_IDX_TO_POS(placement->tile_bit_idx_array[tile_idx], &(current_tile->absolute_pos));
+        for (connection_idx = 0; connection_idx < current_tile->nb_of_connections; connection_idx++)
+            current_tile->connection_direction_array[connection_idx] = placement->tile_connection_direction_array[tile_idx][connection_idx];
+        current_tile->connection_mask = placement->tile_connection_mask_array[tile_idx];
+
+        // the missing connection tiles at this position are now filled, they are not part of the board key anymore
+        toggle_missing_connection_tiles_in_board_key(board, placement->tile_bit_idx_array[tile_idx]);
+
+        // we don't even need to check existing cell, to see if the superposition is allowed, as it has already been done in "can_placement_be_added_to_board"
         // we just do the superposition
-        current_tile->next = existing_tile_stack; // works even if existing_tile_stack == UNDEFINED_TILE
-        board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j] = current_tile;
+        cell = (board->cell_array) + placement->tile_bit_idx_array[tile_idx];
+        cell->piece_idx = placement->piece_idx;
+        cell->tile_idx = tile_idx;
+        cell->normal_connection_mask = current_tile->connection_mask;
     }
 
     // adding missing connection tile data to the board (same exact remarks as in normal tiles case)
     for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
     {
-
         current_tile = side->missing_connection_tile_array + tile_idx;
-        existing_tile_stack = board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j];
 
-        current_tile->next = existing_tile_stack;
-        board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j] = current_tile;
+        BIT_IDX_TO_POS(placement->missing_connection_tile_bit_idx_array[tile_idx], &(current_tile->absolute_pos));
+        current_tile->connection_direction_array[0] = placement->missing_connection_tile_direction_array[tile_idx];
+        current_tile->connection_mask = DIRECTION_TO_MASK(current_tile->connection_direction_array[0]);
+
+        // only missing connection tiles that are not filled are part of the board key
+        if (!(board->normal_tile_mask & POS_TO_BIT_MASK(&(current_tile->absolute_pos))))
+            board->zobrist_key ^= zobrist_keys.missing_connection_tile_key_array[placement->missing_connection_tile_bit_idx_array[tile_idx]][current_tile->connection_direction_array[0]];
+
+        cell = (board->cell_array) + placement->missing_connection_tile_bit_idx_array[tile_idx];
+        cell->nb_of_missing_connections++;
+        cell->missing_connection_mask |= current_tile->connection_mask;
+        cell->path_end_idx_array[current_tile->connection_direction_array[0]] = current_tile->path_end_idx;
     }
 
+    // paths update (before the bitboards update, the normal tiles of the board before the adding are needed)
+    join_paths_of_added_piece(board, side, board->normal_tile_mask);
+
+    // bitboards update
+    // (a second missing connection tile at the same position makes it a double missing connection tile)
+    board->normal_tile_mask |= placement->tile_mask;
+    board->double_missing_connection_tile_mask |= (board->missing_connection_tile_mask & placement->missing_connection_tile_mask);
+    board->missing_connection_tile_mask |= placement->missing_connection_tile_mask;
+    board->zobrist_key ^= placement->zobrist_key;
+
+    // empty regions update (before the piece is recorded, see "split_empty_region")
+    split_empty_region(board, placement);
+    update_open_endpoint_tile_mask(board);
+
     // Record of current blit inputs for the later modular blit functions
-    piece->current_side_idx = side_idx;
-    piece->current_base_pos.i = base_pos.i;
-    piece->current_base_pos.j = base_pos.j;
-    piece->current_rotation_state = rotation_state;
+    piece->current_side_idx = placement->side_idx;
+    piece->current_base_pos = placement->base_pos;
+    piece->current_rotation_state = placement->rotation_state;
+    piece->current_placement_idx = placement_idx;
 
     // check if the piece added is a special piece that we care for double missing connection tiles
     // and update state flags
-    switch (piece_idx)
+    switch (placement->piece_idx)
     {
     case LINE2_2:
         board->has_line2_2_been_added = true;
@@ -526,20 +793,46 @@ int add_piece_to_board(Board *board, int piece_idx, int side_idx, Vector2_int ba
     board->line_double_missing_connection_position = board->temp_line_double_missing_connection_position;
 
     // Record that we actually added the piece
-    board->added_piece_idx_array[board->nb_of_added_pieces] = piece_idx;
+    board->added_piece_idx_array[board->nb_of_added_pieces] = placement->piece_idx;
     board->nb_of_added_pieces++;
 
     return true;
 }
 
+// Function to only run the pre-adding checks of "add_placement_to_board", nothing is added to the board
+// Returns the same error codes, or true (1) if the piece could be added
+int can_placement_idx_be_added_to_board(Board *board, int placement_idx)
+{
+    const Placement *placement = (placement_table.placement_array) + placement_idx;
+    Side *side = (board->piece_array[placement->piece_idx].side_array) + placement->side_idx;
+
+    return can_placement_be_added_to_board(board, side, placement);
+}
+
+// Same as "add_placement_to_board", but with the blit inputs (used by level hints, and manual playing)
+// Returns OUT_OF_BOUNDS if the blit doesn't fit inside the board (as it is not in the placement table)
+int add_piece_to_board(Board *board, int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state)
+{
+    int placement_idx;
+
+    placement_idx = get_placement_idx(piece_idx, side_idx, base_pos, rotation_state);
+    if (placement_idx == UNDEFINED_PLACEMENT_IDX)
+        return OUT_OF_BOUNDS;
+
+    return add_placement_to_board(board, placement_idx);
+}
+
 // Function to undo the last "add_piece_to_board" operation
 void undo_last_piece_adding(Board *board)
 {
-    static int piece_idx;
-    static Piece *piece = NULL;
-    static Side *side = NULL;
-    static Tile *current_tile = NULL;
-    static int tile_idx = 0;
+    int piece_idx;
+    Piece *piece = NULL;
+    Side *side = NULL;
+    const Placement *placement = NULL;
+    Tile *current_tile = NULL;
+    BoardCell *cell = NULL;
+    int tile_idx = 0;
+    uint32_t removed_double_missing_connection_tile_mask;
 
     // grab the last piece_idx added and "remove it" from the stack
     board->nb_of_added_pieces--;
@@ -547,26 +840,47 @@ void undo_last_piece_adding(Board *board)
 
     piece = (board->piece_array) + piece_idx;
     side = (piece->side_array) + piece->current_side_idx;
+    placement = (placement_table.placement_array) + piece->current_placement_idx;
 
     // undo the superposition of normal tiles and missing_connection tiles of the piece (which is still at the same location)
     for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
     {
-        current_tile = (side->tile_array) + tile_idx;
-        board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j] = current_tile->next;
-        current_tile->next = UNDEFINED_TILE;
+        cell = (board->cell_array) + placement->tile_bit_idx_array[tile_idx];
+        cell->piece_idx = NO_PIECE;
+        cell->normal_connection_mask = 0;
+
+        // the missing connection tiles at this position are not filled anymore, they are back in the board key
+        toggle_missing_connection_tiles_in_board_key(board, placement->tile_bit_idx_array[tile_idx]);
     }
 
     for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
     {
         current_tile = (side->missing_connection_tile_array) + tile_idx;
-        board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j] = current_tile->next;
-        current_tile->next = UNDEFINED_TILE;
+
+        // 2 missing connection tiles at the same position never have the same direction (they come from 2 different neighbours)
+        cell = (board->cell_array) + placement->missing_connection_tile_bit_idx_array[tile_idx];
+        cell->nb_of_missing_connections--;
+        cell->missing_connection_mask &= ~(current_tile->connection_mask);
+
+        if (!(board->normal_tile_mask & POS_TO_BIT_MASK(&(current_tile->absolute_pos))))
+            board->zobrist_key ^= zobrist_keys.missing_connection_tile_key_array[placement->missing_connection_tile_bit_idx_array[tile_idx]][current_tile->connection_direction_array[0]];
     }
 
+    // reverse operation of the bitboards update (missing connection tiles are at most 2 per position)
+    removed_double_missing_connection_tile_mask = board->double_missing_connection_tile_mask & placement->missing_connection_tile_mask;
+    board->normal_tile_mask &= ~(placement->tile_mask);
+    board->zobrist_key ^= placement->zobrist_key;
+    board->double_missing_connection_tile_mask &= ~removed_double_missing_connection_tile_mask;
+    board->missing_connection_tile_mask &= ~(placement->missing_connection_tile_mask & ~removed_double_missing_connection_tile_mask);
+
+    merge_empty_region(board);
+    update_open_endpoint_tile_mask(board);
+    split_paths_of_removed_piece(board);
+
     // check if double missing connections are still here
-    if (is_pos_valid(&(board->bend_double_missing_connection_position)) && get_number_of_missing_connection_in_stack(board->tile_matrix[board->bend_double_missing_connection_position.i][board->bend_double_missing_connection_position.j]) != 2)
+    if (is_pos_valid(&(board->bend_double_missing_connection_position)) && !(board->double_missing_connection_tile_mask & POS_TO_BIT_MASK(&(board->bend_double_missing_connection_position))))
         set_invalid_pos(&(board->bend_double_missing_connection_position));
-    if (is_pos_valid(&(board->line_double_missing_connection_position)) && get_number_of_missing_connection_in_stack(board->tile_matrix[board->line_double_missing_connection_position.i][board->line_double_missing_connection_position.j]) != 2)
+    if (is_pos_valid(&(board->line_double_missing_connection_position)) && !(board->double_missing_connection_tile_mask & POS_TO_BIT_MASK(&(board->line_double_missing_connection_position))))
         set_invalid_pos(&(board->line_double_missing_connection_position));
 
     // check if the piece added is a special piece that we care for double missing connection tiles
@@ -578,7 +892,7 @@ void undo_last_piece_adding(Board *board)
 
         // does removing this piece "unfill" a double missing connection tile on the board ?
         current_tile = side->tile_array + LINE_DOUBLE_FILLING_TILE_IDX;
-        if (get_number_of_missing_connection_in_stack(board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j]) == 2)
+        if (board->double_missing_connection_tile_mask & POS_TO_BIT_MASK(&(current_tile->absolute_pos)))
             board->line_double_missing_connection_position = current_tile->absolute_pos;
 
         break;
@@ -587,11 +901,11 @@ void undo_last_piece_adding(Board *board)
 
         // does removing this piece "unfill" a double missing connection tile on the board ?
         current_tile = side->tile_array + BEND_DOUBLE_FILLING_TILE_IDX;
-        if (get_number_of_missing_connection_in_stack(board->tile_matrix[current_tile->absolute_pos.i][current_tile->absolute_pos.j]) == 2)
+        if (board->double_missing_connection_tile_mask & POS_TO_BIT_MASK(&(current_tile->absolute_pos)))
             board->bend_double_missing_connection_position = current_tile->absolute_pos;
 
         break;
     default:
         break;
     }
-}
\ No newline at end of file
+}
@@ -13,67 +13,315 @@
 #include <limits.h> // INT_MAX
 #include <stdlib.h> // abs, NULL
 #include <stdbool.h>
-
-#include <local/utils.h>      // Vector2_int, Direction, helper functions and defines
-#include <local/astar.h>      // see "check_no_dead_ends"
-#include <local/level_data.h> // MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL
-#include <local/piece_data.h> // Tile, Side, Piece and defines
-#include <local/board.h>      // Board, extract_normal_tile_at_pos, and defines
-#include <local/piece.h>      // update_piece_border_tiles
+#include <stdio.h>  // printf
+
+#include <local/utils.h>          // Vector2_int, Direction, helper functions and defines
+#include <local/astar.h>          // see "check_no_dead_ends_with_astar"
+#include <local/level_data.h>     // MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL
+#include <local/piece_data.h>     // Tile, Side, Piece and defines
+#include <local/board.h>          // Board, BoardCell, extract_normal_tile_at_pos, extract_missing_connection_tile_at_pos, and defines
+#include <local/placement.h>      // placement_table
+#include <local/solver_context.h> // SolverContext
+#include <local/disjoint_paths.h> // get_max_nb_of_disjoint_paths
+#include <local/region_shapes.h>  // can_small_region_be_filled, MAX_NB_OF_TILES_PER_SMALL_REGION
 
 #include <local/check_board.h>
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-// -------------- Helper functions of "check_isoleted_tiles_around_piece" ---------------------------------------
+// -------------- Main function ---------------------------------------------------------------------------------
 
-static bool is_tile_pos_isolated(Board *board, Vector2_int *pos)
+// Function to check if adding the piece to the board didn't let an empty tile completely isolated
+// Because we know that it can't be filled by any piece and all tiles must be filled to have a complete board
+// (empty in terms of normal tiles only: missing connection tiles doesn't count as "filled" here)
+// The only regions that changed are the parts of the region the piece has been added in (see board.c > "split_empty_region"),
+// an empty tile is isolated <=> one of these parts has only 1 tile
+// Returns bool, true if everything is fine
+static bool check_isolated_tiles_around_piece(Board *board)
 {
-    static Direction dir;
-    static Vector2_int temp_pos;
-    // it must have at least another empty neighbour (empty in terms of normal tiles only: missing connection tiles doesn't count as "filled" here)
-    for (dir = RIGHT; dir < NB_OF_DIRECTIONS; dir++)
+    EmptyRegionSplit *split = (board->empty_region_split_array) + (board->nb_of_added_pieces - 1);
+    uint32_t region_mask;
+    int region_idx;
+
+    // the part that kept the region index, then the new ones at the end of the array
+    region_mask = board->empty_region_mask_array[split->region_idx];
+    if (region_mask && !(region_mask & (region_mask - 1)))
+        return false;
+
+    for (region_idx = board->nb_of_empty_regions - split->nb_of_new_regions; region_idx < board->nb_of_empty_regions; region_idx++)
     {
-        temp_pos.i = pos->i;
-        temp_pos.j = pos->j;
-        increment_pos_in_direction(&temp_pos, dir);
-        if (!is_pos_inside_board(&temp_pos))
-            continue; // an increment might lead to out of bounds
-
-        // is there another empty tile at this neighbour location ?
-        if (extract_normal_tile_at_pos(board, &temp_pos) == UNDEFINED_TILE)
-            return false; // case where the answer is yes -> the tile is not isolated
+        region_mask = board->empty_region_mask_array[region_idx];
+        if (!(region_mask & (region_mask - 1)))
+            return false;
     }
 
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 // -------------- Main function ---------------------------------------------------------------------------------
 
-// Function to check if adding the piece to the board didn't let an empty tile completely isolated
-// Because we know that it can't be filled by any piece and all tiles must be filled to have a complete board
-// We only have to check tiles around the piece (which are called "border tiles")
+// Function to make sure that adding the piece to the board didn't create loop connection path
+// As they are not allowed in the game rules
+// Therefore, a board that contains a loop is not valid
+// The board knows the other end of each open path end, and counts the paths closed on themselves (see board.c > "join_paths_of_added_piece")
+// It also detects future loops : the 2 ends of a double missing connection tile (that isn't filled) will necessary be linked by the tile filling it
+// so if they are the 2 ends of the same path, it will become a loop
+// (the game rules allow at most 2 double missing connection tiles on a board, see board.c > "can_placement_be_added_to_board")
+static bool check_no_loops(Board *board)
+{
+    uint32_t double_missing_connection_tile_mask;
+    BoardCell *cell;
+    uint8_t missing_connection_mask;
+
+    if (board->nb_of_loops > 0)
+        return false;
+
+    double_missing_connection_tile_mask = board->double_missing_connection_tile_mask & ~(board->normal_tile_mask);
+    for (; double_missing_connection_tile_mask; double_missing_connection_tile_mask &= double_missing_connection_tile_mask - 1)
+    {
+        // the 2 missing connection tiles of the cell
+        cell = (board->cell_array) + LOWEST_BIT_IDX(double_missing_connection_tile_mask);
+        missing_connection_mask = cell->missing_connection_mask;
+
+        if (board->path_partner_idx_array[cell->path_end_idx_array[LOWEST_BIT_IDX(missing_connection_mask)]] == cell->path_end_idx_array[LOWEST_BIT_IDX(missing_connection_mask & (missing_connection_mask - 1))])
+            return false;
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// -------------- Helper functions of "check_region_sizes" ---------------------------------------
+
+// Returns the mask of the pieces that are not on the board yet (bit piece_idx set <=> the piece is remaining)
+static int get_remaining_piece_mask(Board *board)
+{
+    int remaining_piece_mask = (1 << NB_OF_PIECES) - 1;
+
+    for (int piece_idx = 0; piece_idx < board->nb_of_added_pieces; piece_idx++)
+        remaining_piece_mask &= ~(1 << board->added_piece_idx_array[piece_idx]);
+
+    return remaining_piece_mask;
+}
+
+// Function to find out if the regions can be filled by the pieces of "piece_mask", each piece in exactly 1 region
+// The pieces of the first region are chosen among the subsets of piece_mask that have the right number of tiles, and the other regions are filled recursively
+// (the regions and the pieces have the same total number of tiles, so the last region is always filled by the pieces that are left)
+static bool can_regions_be_filled(int region_size_array[], int nb_of_regions, int piece_mask)
+{
+    int subset_piece_mask;
+
+    if (nb_of_regions <= 1)
+        return true;
+
+    for (subset_piece_mask = piece_mask; subset_piece_mask; subset_piece_mask = (subset_piece_mask - 1) & piece_mask)
+        if (placement_table.subset_nb_of_tiles_array[subset_piece_mask] == region_size_array[0] && can_regions_be_filled(region_size_array + 1, nb_of_regions - 1, piece_mask ^ subset_piece_mask))
+            return true;
+
+    return false;
+}
+
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check if the empty regions of the board (see board.c > "split_empty_region") can still be filled by the remaining pieces
+// Pieces can't overlap 2 regions, so each region has to be filled exactly by some of the remaining pieces, and each remaining piece is in 1 region
+// 1) each region size must be a total number of tiles of some remaining pieces (precomputed for every subset of pieces, see placement.c > "load_subset_sizes")
+// 2) with 3 regions or more, 1) isn't enough, as 2 regions may need the same pieces, so the pieces are actually split between the regions
+// (with 2 regions, the pieces that aren't in the first region fill exactly the second one)
+// Returns bool, true if everything is fine
+static bool check_region_sizes(Board *board)
+{
+    int remaining_piece_mask = get_remaining_piece_mask(board);
+    uint64_t size_mask;
+    int region_size_array[MAX_NB_OF_EMPTY_REGIONS];
+    int nb_of_regions = 0;
+    int region_idx;
+
+    // 1)
+    size_mask = placement_table.subset_size_mask_array[remaining_piece_mask];
+    for (region_idx = 0; region_idx < board->nb_of_empty_regions; region_idx++)
+    {
+        if (board->empty_region_mask_array[region_idx] == 0)
+            continue;
+
+        region_size_array[nb_of_regions] = NB_OF_TILES_IN_MASK(board->empty_region_mask_array[region_idx]);
+        if (!((size_mask >> region_size_array[nb_of_regions]) & 1))
+            return false;
+        nb_of_regions++;
+    }
+
+    // 2)
+    if (nb_of_regions < 3)
+        return true;
+
+    return can_regions_be_filled(region_size_array, nb_of_regions, remaining_piece_mask);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check that the small empty regions can be filled by some of the remaining pieces, given their shapes
+// A small hole needs pieces of its exact shape, whatever its number of tiles (an L-shaped hole of 3 tiles can only be filled by a corner piece),
+// the subsets of pieces that can fill each shape of up to MAX_NB_OF_TILES_PER_SMALL_REGION tiles are precomputed (see region_shapes.c)
+// Returns bool, true if everything is fine
+static bool check_small_region_shapes(Board *board)
+{
+    int remaining_piece_mask = get_remaining_piece_mask(board);
+    uint32_t region_mask;
+    int nb_of_tiles;
+
+    for (int region_idx = 0; region_idx < board->nb_of_empty_regions; region_idx++)
+    {
+        region_mask = board->empty_region_mask_array[region_idx];
+        nb_of_tiles = NB_OF_TILES_IN_MASK(region_mask);
+        if (nb_of_tiles == 0 || nb_of_tiles > MAX_NB_OF_TILES_PER_SMALL_REGION)
+            continue;
+
+        if (!can_small_region_be_filled(region_mask, remaining_piece_mask))
+            return false;
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check if the empty tiles of the board have a colour imbalance that the remaining pieces can have
+// On a checkerboard colouring (see utils.h > BLACK_TILE_MASK), the remaining pieces cover exactly the empty tiles, so they have the same number of black tiles minus white tiles
+// the imbalances that each subset of pieces can have are precomputed (see placement.c > "load_subset_colour_imbalances"), so it's only 2 popcounts and a lookup
 // Returns bool, true if everything is fine
-static bool check_isolated_tiles_around_piece(Board *board, Piece *piece)
+static bool check_colour_imbalance(Board *board)
 {
-    static int i;
-    static Vector2_int *pos;
+    return (placement_table.subset_colour_imbalance_mask_array[get_remaining_piece_mask(board)] & COLOUR_IMBALANCE_TO_BIT_MASK(COLOUR_IMBALANCE_OF_MASK(~(board->normal_tile_mask)))) != 0;
+}
 
-    update_piece_border_tiles(piece);
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// -------------- Helper functions of "check_tile_type_budget" ---------------------------------------
+
+// Function to find out if each piece of "piece_mask" can play 1 of its sides (the ones of Board::playable_side_mask_array), so that they have exactly "tile_type_counts" tiles of each type
+// (see piece_data.h > TILE_TYPE_COUNT_SHIFT), sides are chosen piece by piece, and a side with too many tiles of a type stops the search right away
+static bool can_sides_supply_tile_types(Board *board, int piece_mask, uint32_t tile_type_counts)
+{
+    int piece_idx;
+    uint8_t side_mask;
+    uint32_t side_tile_type_counts;
 
-    for (i = 0; i < piece->nb_of_border_tiles; i++)
+    if (piece_mask == 0)
+        return tile_type_counts == 0;
+
+    piece_idx = LOWEST_BIT_IDX(piece_mask);
+    for (side_mask = board->playable_side_mask_array[piece_idx]; side_mask; side_mask &= side_mask - 1)
     {
-        pos = (piece->border_tile_absolute_pos_array) + i;
-        if (!is_pos_valid(pos))
-            continue; // we know already if a border tile is within board boundary or not, we only check if not out of bounds
+        side_tile_type_counts = board->piece_array[piece_idx].side_array[LOWEST_BIT_IDX(side_mask)].tile_type_counts;
+        if (ARE_TILE_TYPE_COUNTS_ENOUGH(tile_type_counts, side_tile_type_counts) && can_sides_supply_tile_types(board, piece_mask & (piece_mask - 1), tile_type_counts - side_tile_type_counts))
+            return true;
+    }
+
+    return false;
+}
 
-        if (extract_normal_tile_at_pos(board, pos) != UNDEFINED_TILE)
-            continue; // case where the border tile is already filled with a normal tile, they are not concerned by this check, only empty border tiles
+// Returns the number of level hint tiles of each type on the empty positions of the board (see piece_data.h > TILE_TYPE_COUNT_SHIFT)
+static uint32_t get_empty_tile_type_counts(Board *board)
+{
+    uint32_t tile_type_counts = 0;
+
+    for (int tile_type = 0; tile_type < NB_OF_NORMAL_TILE_TYPES; tile_type++)
+        tile_type_counts |= ((uint32_t)NB_OF_TILES_IN_MASK(board->obligatory_tile_type_mask_array[tile_type] & ~(board->normal_tile_mask))) << TILE_TYPE_COUNT_SHIFT(tile_type);
+
+    return tile_type_counts;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
 
-        if (is_tile_pos_isolated(board, pos))
-            return false; // if only 1 of empty border tiles is isolated, the whole check fail
+// Function to check if the remaining pieces can still match the tile types of the level hints, on levels that give the tile type of every position (expert levels)
+// Every empty position will be covered by a tile of the same type as its level hint (see board.c > "is_tile_matching_level_hints"),
+// so the playable sides of the remaining pieces must have exactly as many tiles of each type as the level hints of the empty positions
+// Returns bool, true if everything is fine (always on the other levels)
+static bool check_tile_type_budget(Board *board)
+{
+    if (!board->has_full_tile_type_hints)
+        return true;
+
+    return can_sides_supply_tile_types(board, get_remaining_piece_mask(board), get_empty_tile_type_counts(board));
+}
+
+// Function to forbid right away the sides that can't be part of any side choice that matches the tile types of the level hints (see "check_tile_type_budget")
+// so that their placements are never tried, they are forbidden in "playable_side_per_piece_idx_mask" (the sides of the current combination, see search_algorithm.c > "load_combination_data")
+// It has to be called on the board of the level hints
+// @note the sides that are tried are all the sides of each piece, not only the ones of the current combination, so that the tile type budget only depends on the board :
+// the combination skipping trick (see search_algorithm.c > "is_current_combination_skippable") and the transposition table assume that a board is dead whatever the next pieces of the combination are
+// (the number of point tiles of the level hints already forces the right number of point sides)
+void prune_playable_sides_with_tile_type_budget(Board *board, bool playable_side_per_piece_idx_mask[][MAX_NB_OF_SIDE_PER_PIECE])
+{
+    int remaining_piece_mask, piece_idx, side_idx;
+    uint32_t tile_type_counts;
+    uint8_t side_mask;
+
+    if (!board->has_full_tile_type_hints)
+        return;
+
+    remaining_piece_mask = get_remaining_piece_mask(board);
+    tile_type_counts = get_empty_tile_type_counts(board);
+
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        board->playable_side_mask_array[piece_idx] = (1 << board->piece_array[piece_idx].nb_of_sides) - 1;
+
+    // each side is tried as the only playable side of its piece
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        if (!(remaining_piece_mask & (1 << piece_idx)))
+            continue;
+
+        side_mask = board->playable_side_mask_array[piece_idx];
+        for (side_idx = 0; side_idx < board->piece_array[piece_idx].nb_of_sides; side_idx++)
+        {
+            board->playable_side_mask_array[piece_idx] = 1 << side_idx;
+            if (!can_sides_supply_tile_types(board, remaining_piece_mask, tile_type_counts))
+                side_mask &= ~(1 << side_idx);
+        }
+        board->playable_side_mask_array[piece_idx] = side_mask;
+
+        for (side_idx = 0; side_idx < board->piece_array[piece_idx].nb_of_sides; side_idx++)
+            if (!(side_mask & (1 << side_idx)))
+                playable_side_per_piece_idx_mask[piece_idx][side_idx] = false;
     }
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check that the path ends of each empty region can be paired
+// A future path can only go through empty tiles, so it links 2 ends of the same region (the open missing connections and the open level points, see board.c > "update_open_endpoint_tile_mask")
+// and every end is linked to exactly 1 other end, so each region must have an even number of ends
+// (the point tiles of the solution are all given by the level hints, so a path can't end anywhere else)
+// It's a cheaper necessary condition than "check_no_dead_ends", that also catches regions with 3 ends
+// Returns bool, true if everything is fine
+static bool check_path_end_parity(Board *board)
+{
+    for (int region_idx = 0; region_idx < board->nb_of_empty_regions; region_idx++)
+        if (NB_OF_TILES_IN_MASK(board->empty_region_mask_array[region_idx] & board->open_endpoint_tile_mask) & 1)
+            return false;
 
     return true;
 }
@@ -82,23 +330,78 @@ static bool check_isolated_tiles_around_piece(Board *board, Piece *piece)
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-// -------------- Helper function of "check_no_loops" ---------------------------------------
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check if the current open missing connections on the board can still be linked by a future path between them
+// If not, this is obviously bad, and the board is discarded
+// How do I check this ?
+// 1) The board keeps the tiles concerned by this check (see board.c > "update_open_endpoint_tile_mask")
+// and the empty regions of the board (empty in terms of normal tiles only), up to date at each adding (see board.c > "split_empty_region")
+// A future path can only go through empty tiles, so 2 tiles can be linked <=> they are in the same empty region
+// 2) Each tile to check needs at least one other tile to check in its region
+// (the tile which is linked by an actual path to it doesn't count, (mostly to avoid pieces that find a valid path to themselve))
+// if one of them doesn't have any, it means that there's a dead end and the function returns false
+// else returns true
+//
+// (it used to be a pathfinding (see astar.c) for each tile to check, see "check_no_dead_ends_with_astar", kept for benchmarks)
+static bool check_no_dead_ends(Board *board)
+{
+    uint32_t endpoint_tile_mask = board->open_endpoint_tile_mask;
+    uint32_t remaining_tile_mask, start_tile_mask, other_endpoint_tile_mask;
+    BoardCell *start_cell;
+    Tile *not_allowed_target_tile;
+    int bit_idx, partner_idx;
+
+    // mini different check added : double missing connections are just not allowed on a open tile point (there's no piece that has a point tile with 2 connections)
+    if (board->double_missing_connection_tile_mask & board->obligatory_point_tile_mask & ~(board->normal_tile_mask))
+        return false;
+
+    for (remaining_tile_mask = endpoint_tile_mask; remaining_tile_mask; remaining_tile_mask &= remaining_tile_mask - 1)
+    {
+        bit_idx = LOWEST_BIT_IDX(remaining_tile_mask);
+        start_tile_mask = ((uint32_t)1) << bit_idx;
+
+        other_endpoint_tile_mask = board->empty_region_mask_array[board->empty_region_idx_array[bit_idx]] & endpoint_tile_mask & ~start_tile_mask;
+
+        if (other_endpoint_tile_mask == 0)
+            return false;
+
+        // with 2 other tiles or more, at least 1 of them isn't linked to the starting tile
+        if (other_endpoint_tile_mask & (other_endpoint_tile_mask - 1))
+            continue;
+
+        // the only tile at this position is the missing connection tile
+        // (or nothing if it is a open point of the level, it isn't the end of a path yet)
+        start_cell = (board->cell_array) + bit_idx;
+        if (start_cell->nb_of_missing_connections == 0)
+            continue;
+
+        // the other end of its path (see board.c > "join_paths_of_added_piece")
+        partner_idx = board->path_partner_idx_array[start_cell->path_end_idx_array[LOWEST_BIT_IDX(start_cell->missing_connection_mask)]];
+        if (partner_idx == NO_PATH_END)
+            continue;
+
+        not_allowed_target_tile = get_path_end_tile(board, partner_idx);
+        if (other_endpoint_tile_mask == POS_TO_BIT_MASK(&(not_allowed_target_tile->absolute_pos)))
+            return false;
+    }
+
+    return true;
+}
 
-// (The one below also help the "check_no_dead_ends" method)
+// -------------- Helper function of "check_no_dead_ends_with_astar" ---------------------------------------
 
 // Function to follow a connection path from a missing connection starting point
 // Stop following the path if it reaches a point tile, an end of path (incomplete path), or if it detected that it followed a loop path
-// Returns the board tile stack pointer, of the location where it stopped following the path
+// Returns a tile of the board at the location where it stopped following the path (its normal tile if there is one, else a missing connection tile)
 static Tile *follow_path(Board *board, Tile *missing_connection_tile)
 {
     // warning : the input missing connnection might already been filled on the board but it doesn't matter here
-    static Tile *current_tile_stack = UNDEFINED_TILE;
-    static Tile *normal_tile = UNDEFINED_TILE;
-    static Vector2_int current_pos, start_pos;
-    static Direction next_direction, discarded_direction;
-    static int connection_idx;
+    BoardCell *current_cell = NULL;
+    Vector2_int current_pos, start_pos;
+    Direction next_direction;
+    uint8_t next_connection_mask;
 
-    current_tile_stack = UNDEFINED_TILE;
     start_pos = missing_connection_tile->absolute_pos;
 
     // Initialisation of iterative variables
@@ -108,7 +411,7 @@ static Tile *follow_path(Board *board, Tile *missing_connection_tile)
     while (true)
     {
         increment_pos_in_direction(&current_pos, next_direction);
-        current_tile_stack = board->tile_matrix[current_pos.i][current_pos.j];
+        current_cell = (board->cell_array) + POS_TO_BIT_IDX(current_pos.i, current_pos.j);
 
         if (are_pos_equal(&start_pos, &current_pos))
             // case where we followed a loop path
@@ -117,9 +420,7 @@ static Tile *follow_path(Board *board, Tile *missing_connection_tile)
             break;
 
         // is there a normal tile at this location to even continue following a path ?
-        normal_tile = extract_normal_tile_from_stack(current_tile_stack);
-
-        if (normal_tile == UNDEFINED_TILE)
+        if (current_cell->piece_idx == NO_PIECE)
             // answer : no
             // case where the path ends, the current_pos is on a missing connection tile (or double missing), that is not filled
             // stop following the path
@@ -128,67 +429,93 @@ static Tile *follow_path(Board *board, Tile *missing_connection_tile)
         // answer : yes
         // general case where the next tile in the path is a normal tile
         // we have to follow its connection directions without going backwards
-        discarded_direction = reverse_direction(next_direction);
-        next_direction = -1;
-        for (connection_idx = 0; connection_idx < normal_tile->nb_of_connections; connection_idx++)
-        {
-            // pick the first next direction that is not the discarded direction
-            if (normal_tile->connection_direction_array[connection_idx] == discarded_direction)
-                continue;
-
-            next_direction = normal_tile->connection_direction_array[connection_idx];
-            break;
-        }
+        next_connection_mask = current_cell->normal_connection_mask & ~DIRECTION_TO_MASK(reverse_direction(next_direction));
 
-        if (next_direction == -1)
+        if (!next_connection_mask)
             break; // if we don't found a new direction to go, we stop following the path, as we are on a point tile
+
+        next_direction = LOWEST_BIT_IDX(next_connection_mask);
     }
 
-    return current_tile_stack;
+    if (current_cell->piece_idx != NO_PIECE)
+        return extract_normal_tile_at_pos(board, &current_pos);
+
+    return extract_missing_connection_tile_at_pos(board, &current_pos);
 }
 
-// -------------- Main function ---------------------------------------------------------------------------------
+// -------------- Helper functions of "check_no_dead_ends_with_astar" -----------------------------------------------------------
 
-// Function to make sure that adding the piece to the board didn't create loop connection path
-// As they are not allowed in the game rules
-// Therefore, a board that contains a loop is not valid
-static bool check_no_loops(Board *board, Piece *piece)
+// Function to pick the board tiles that are concerned by the dead end check, loaded by reference in "target_tile_array"
+// We want all open missing connections ("open" meaning that, they aren't filled yet by other piece normal tiles on the board)
+// We don't want double missing connections either (as the path linking them is necessary a single tile, it's like a trivial case)
+// We also want to include level obligatory point tiles, if they are still open
+// Returns the number of picked tiles, or -1 if the board already has a dead end
+static int load_dead_end_targets(Board *board, Tile *target_tile_array[])
 {
-    // (There are some rare cases where a future loop will not be identified by this implementation
-    // Where with the current played pieces, there is an incomplete loop path (1 tile hole in the path) (we know it's not ok, because the only possibility to complete the path is to complete a loop)
-    // If the last piece added to this incomplete loop path is not directly in contact with the hole in the loop
-    // or if it is in direct contact, its not the right missing connection choosen in "susceptible_loop_generator_missing_connection_tile_idx_array" (see piece_data.h), the missing connection where is the hole is ignored)
+    int piece_idx, tile_idx;
+    Piece *piece;
+    Side *side;
+    Tile *tile;
+    Tile *obligatory_tile;
+    uint32_t pos_bit_mask;
+    int nb_of_targets = 0;
+
+    // append the open points of the level hints
+    //(before the actual missing connection tiles to start by them in the pathfinding)
+    // (because the pathfinding starting from these tiles is more likely to end up on a missing connection tile, thus mark it as already checked, and letting us skip iterations)
+    for (tile_idx = 0; tile_idx < board->nb_of_open_obligatory_point_tiles; tile_idx++)
+    {
+        tile = board->open_obligatory_point_tile_array[tile_idx];
+        pos_bit_mask = POS_TO_BIT_MASK(&(tile->absolute_pos));
 
-    // at least it detects complete loops 100% of the time
+        // mini different check added : double missing connections are just not allowed on a open tile point (there's no piece that has a point tile with 2 connections)
+        if (board->double_missing_connection_tile_mask & pos_bit_mask)
+            return -1;
 
-    static Side *side;
-    static int tile_selected, tile_idx;
-    static Tile *tile;
-    static Tile *result_tile_stack;
+        // is the point already filled ? (even if it's already filled with a missing connection, it's already taken into account, so ignore it)
+        if ((board->normal_tile_mask | board->missing_connection_tile_mask) & pos_bit_mask)
+            //  yes so skip it
+            continue;
 
-    side = (piece->side_array) + (piece->current_side_idx);
+        // add it to the list
+        target_tile_array[nb_of_targets] = tile;
+        nb_of_targets++;
+    }
 
-    // follow the paths starting from each susceptible missing connection tile of the played piece
-    // if the starting and ending point of the same path, are at the same position on the board, it's a loop
-    for (tile_selected = 0; tile_selected < side->nb_of_susceptible_loop_generator_tiles; tile_selected++)
+    // append the open missing connection tiles of the already played pieces
+    for (piece_idx = 0; piece_idx < board->nb_of_added_pieces; piece_idx++)
     {
-        tile_idx = (side->susceptible_loop_generator_missing_connection_tile_idx_array[tile_selected]);
-        tile = (side->missing_connection_tile_array) + tile_idx;
-        result_tile_stack = follow_path(board, tile);
+        piece = (board->piece_array) + board->added_piece_idx_array[piece_idx];
+        side = (piece->side_array) + (piece->current_side_idx);
 
-        if (are_pos_equal(&(tile->absolute_pos), &(result_tile_stack->absolute_pos)))
-            // this is a loop
-            return false;
+        for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+        {
+            tile = (side->missing_connection_tile_array) + tile_idx;
+            pos_bit_mask = POS_TO_BIT_MASK(&(tile->absolute_pos));
+
+            // is the missing connection already filled ?
+            if (board->normal_tile_mask & pos_bit_mask)
+                // yes so skip it
+                continue;
+
+            // also ignore double missing connection tiles
+            if (board->double_missing_connection_tile_mask & pos_bit_mask)
+                continue;
+
+            // single missing connection tile superposed to a point tile is also to be considered like if it was a double missing connection
+            obligatory_tile = board->obligatory_tile_matrix[tile->absolute_pos.i][tile->absolute_pos.j];
+            if (obligatory_tile != UNDEFINED_TILE && obligatory_tile->tile_type == point)
+                continue;
+
+            // add it to the list
+            target_tile_array[nb_of_targets] = tile;
+            nb_of_targets++;
+        }
     }
 
-    return true;
+    return nb_of_targets;
 }
 
-// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-
-// -------------- Helper functions of "check_no_dead_ends" -----------------------------------------------------------
 
 // Function to get the nearest target tile from the starting tile
 // also discard "not_allowed_target_tile" if not UNDEFINED_TILE (alias for NULL)
@@ -196,8 +523,8 @@ static bool check_no_loops(Board *board, Piece *piece)
 // returns -1 if there is no nearest valid target tile
 static int get_nearest_target_tile_idx(Tile *start_tile, Tile *missing_connection_to_check_array[NB_OF_PIECES * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE], int nb_of_missing_connections_to_check, Tile *not_allowed_target_tile)
 {
-    static int min_dist, min_idx, idx, dist;
-    static Tile *tile;
+    int min_dist, min_idx, idx, dist;
+    Tile *tile;
 
     min_dist = INT_MAX;
     min_idx = -1;
@@ -224,16 +551,8 @@ static int get_nearest_target_tile_idx(Tile *start_tile, Tile *missing_connectio
     return min_idx;
 }
 
-// -------------- Main function ---------------------------------------------------------------------------------
-
-// Function to check if the current open missing connections on the board can still be linked by a future path between them
-// If not, this is obviously bad, and the board is discarded
-// How do I check this ?
-// 1) First off : pick the board tiles that are concerned by this check
-// We want all open missing connections ("open" meaning that, they aren't filled yet by other piece normal tiles on the board)
-// We don't want double missing connections either (as the path linking them is necessary a single tile, it's like a trivial case)
-// We also want to include level obligatory point tiles, if they are still open
-// Result : a list of tile position to check
+// Previous version of "check_no_dead_ends", with a pathfinding algorithm (see astar.c), only used with CheckSettings::use_astar_dead_end_check (see batch_solver.c > ASTAR_ENGINE)
+// 1) Pick the tiles to check (see "load_dead_end_targets")
 // 2) For each tile to check : run a pathfinding algorithm starting from this tile , and see if there's at least one valid path remaining to another tile position to check
 // (if an open missing connection tile is linked by an actual path to the starting tile, this tile is discarded from the valid targets list, for this particular pathfinding) (mostly to avoid pieces that find a valid path to themselve)
 // we target the nearest other tile from the list (other = different from the starting tile), but all other tiles from the list can be valid ending to the pathfinding algorithm
@@ -241,25 +560,19 @@ static int get_nearest_target_tile_idx(Tile *start_tile, Tile *missing_connectio
 // if the pathfinding algorithm find a path, the ending tile of the path is recorded as already checked
 // if the pathfinding algorithm can't find at least one valid path for each tile to check, it means that there's a dead end and the function returns false
 // else returns true
-static bool check_no_dead_ends(Board *board)
+static bool check_no_dead_ends_with_astar(Board *board, SolverContext *context)
 {
     // temp variables
-    static int piece_idx, tile_idx, i, j;
-    static Piece *piece;
-    static Side *side;
-    static Tile *tile;
-    static Tile *board_tile_stack, *obligatory_tile;
-    static Tile *start_tile, *not_allowed_target_tile, *nearest_target_tile, *end_tile;
-    static int nearest_target_tile_idx;
-
-    // starting and ending points of the pathfinding algorithm
-    static Tile *missing_connection_to_check_array[NB_OF_PIECES * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE + MAX_NB_OF_OPEN_POINT_TILES_PER_LEVEL];
-    static int nb_of_missing_connections_to_check;
-    static bool has_already_been_check_matrix[BOARD_WIDTH][BOARD_HEIGHT];
-    static SimpleTileType temp_removed_representation_infos[2];
-    static SimpleTileType board_representation_matrix[BOARD_WIDTH][BOARD_HEIGHT]; // see astar.h
-
-    nb_of_missing_connections_to_check = 0;
+    int tile_idx, i, j;
+    Tile *start_tile, *not_allowed_target_tile, *nearest_target_tile, *end_tile;
+    int nearest_target_tile_idx;
+
+    // starting and ending points of the pathfinding algorithm (memory of the solver context, see solver_context.h)
+    Tile **missing_connection_to_check_array = context->missing_connection_to_check_array;
+    int nb_of_missing_connections_to_check;
+    bool(*has_already_been_check_matrix)[BOARD_HEIGHT] = context->has_already_been_check_matrix;
+    SimpleTileType temp_removed_representation_infos[2];
+    SimpleTileType(*board_representation_matrix)[BOARD_HEIGHT] = context->board_representation_matrix; // see astar.h
 
     // initialize board_representation_matrix
     for (i = 0; i < BOARD_WIDTH; i++)
@@ -269,62 +582,15 @@ static bool check_no_dead_ends(Board *board)
     }
 
     // 1) Picking the starting tiles to check
+    nb_of_missing_connections_to_check = load_dead_end_targets(board, missing_connection_to_check_array);
+    if (nb_of_missing_connections_to_check < 0)
+        return false;
 
-    // append the open points of the level hints
-    //(before the actual missing connection tiles to start by them in step 2))
-    // (because the pathfinding starting from these tiles is more likely to end up on a missing connection tile, thus mark it as already checked, and letting us skip iterations)
-    for (tile_idx = 0; tile_idx < board->nb_of_open_obligatory_point_tiles; tile_idx++)
-    {
-        tile = board->open_obligatory_point_tile_array[tile_idx];
-        board_tile_stack = board->tile_matrix[tile->absolute_pos.i][tile->absolute_pos.j];
-
-        // mini different check added : double missing connections are just not allowed on a open tile point (there's no piece that has a point tile with 2 connections)
-        if (get_number_of_missing_connection_in_stack(board_tile_stack) == 2)
-            return false;
-
-        // is the point already filled ? (even if it's already filled with a missing connection, it's already taken into account, so ignore it)
-        if (board_tile_stack != UNDEFINED_TILE)
-            //  yes so skip it
-            continue;
-
-        // add it to the list
-        has_already_been_check_matrix[tile->absolute_pos.i][tile->absolute_pos.j] = false;
-        board_representation_matrix[tile->absolute_pos.i][tile->absolute_pos.j] = target;
-        missing_connection_to_check_array[nb_of_missing_connections_to_check] = tile;
-        nb_of_missing_connections_to_check++;
-    }
-
-    // append the open missing connection tiles of the already played pieces
-    for (piece_idx = 0; piece_idx < board->nb_of_added_pieces; piece_idx++)
+    for (tile_idx = 0; tile_idx < nb_of_missing_connections_to_check; tile_idx++)
     {
-        piece = (board->piece_array) + board->added_piece_idx_array[piece_idx];
-        side = (piece->side_array) + (piece->current_side_idx);
-
-        for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
-        {
-            tile = (side->missing_connection_tile_array) + tile_idx;
-            board_tile_stack = board->tile_matrix[tile->absolute_pos.i][tile->absolute_pos.j];
-
-            // is the missing connection already filled ?
-            if (extract_normal_tile_from_stack(board_tile_stack) != UNDEFINED_TILE)
-                // yes so skip it
-                continue;
-
-            // also ignore double missing connection tiles
-            if (get_number_of_missing_connection_in_stack(board_tile_stack) == 2)
-                continue;
-
-            // single missing connection tile superposed to a point tile is also to be considered like if it was a double missing connection
-            obligatory_tile = board->obligatory_tile_matrix[tile->absolute_pos.i][tile->absolute_pos.j];
-            if (obligatory_tile != UNDEFINED_TILE && obligatory_tile->tile_type == point)
-                continue;
-
-            // add it to the list
-            has_already_been_check_matrix[tile->absolute_pos.i][tile->absolute_pos.j] = false;
-            board_representation_matrix[tile->absolute_pos.i][tile->absolute_pos.j] = target;
-            missing_connection_to_check_array[nb_of_missing_connections_to_check] = tile;
-            nb_of_missing_connections_to_check++;
-        }
+        start_tile = missing_connection_to_check_array[tile_idx];
+        has_already_been_check_matrix[start_tile->absolute_pos.i][start_tile->absolute_pos.j] = false;
+        board_representation_matrix[start_tile->absolute_pos.i][start_tile->absolute_pos.j] = target;
     }
 
     // 2)  pathfinding algorithm for each missing connection tile to check
@@ -364,7 +630,7 @@ static bool check_no_dead_ends(Board *board)
         board_representation_matrix[start_tile->absolute_pos.i][start_tile->absolute_pos.j] = no_info;
 
         // actual pathfinding that returns the tile that it ends up on, if it found a path to it, see astar.c
-        end_tile = find_a_path(board, &(start_tile->absolute_pos), &(nearest_target_tile->absolute_pos), board_representation_matrix);
+        end_tile = find_a_path(board, &(start_tile->absolute_pos), &(nearest_target_tile->absolute_pos), board_representation_matrix, &(context->astar_memory));
 
         // main concern check
         if (end_tile == UNDEFINED_TILE)
@@ -388,6 +654,83 @@ static bool check_no_dead_ends(Board *board)
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to check that the path ends of each empty region can all be linked at the same time
+// "check_no_dead_ends" only makes sure that each end can reach another one, but 2 future paths can't go through the same tile (a tile has at most 2 connections)
+// so a region where 2 paths would need the same 1 tile corridor is accepted by it
+// How do I check this ?
+// 1) the tiles of the region that future paths can go through : all of them except the double missing connection tiles, and the missing connection tiles on a level point (their path is already known)
+// 2) if the ends can be linked 2 by 2, with paths that don't share any tile, then orienting each path splits the ends in 2 halves (path starts and path ends),
+// with as many paths from the first half to the second half as there are pairs (see disjoint_paths.c)
+// 3) so all the ways to split the ends in 2 halves are tried (the first end is always a start, there are 35 ways with 8 ends), if none of them has enough paths, the ends can't be linked
+// (regions with more than MAX_NB_OF_PATH_ENDS_FOR_DISJOINT_PATHS_CHECK ends are accepted, there would be too many ways to try)
+// Returns bool, true if everything is fine
+static bool check_disjoint_paths(Board *board)
+{
+    uint32_t region_mask, free_tile_mask, end_tile_mask, remaining_tile_mask, source_tile_mask;
+    int end_bit_idx_array[MAX_NB_OF_PATH_ENDS_FOR_DISJOINT_PATHS_CHECK];
+    int nb_of_ends, nb_of_pairs, half_mask, end_idx;
+    bool can_ends_be_linked;
+
+    for (int region_idx = 0; region_idx < board->nb_of_empty_regions; region_idx++)
+    {
+        region_mask = board->empty_region_mask_array[region_idx];
+        end_tile_mask = region_mask & board->open_endpoint_tile_mask;
+        nb_of_ends = NB_OF_TILES_IN_MASK(end_tile_mask);
+        if (nb_of_ends == 0 || nb_of_ends > MAX_NB_OF_PATH_ENDS_FOR_DISJOINT_PATHS_CHECK)
+            continue;
+
+        // 1)
+        free_tile_mask = region_mask & ~(board->double_missing_connection_tile_mask) & ~(board->missing_connection_tile_mask & board->obligatory_point_tile_mask);
+
+        end_idx = 0;
+        for (remaining_tile_mask = end_tile_mask; remaining_tile_mask; remaining_tile_mask &= remaining_tile_mask - 1)
+            end_bit_idx_array[end_idx++] = LOWEST_BIT_IDX(remaining_tile_mask);
+        nb_of_pairs = nb_of_ends / 2; // (the number of ends is even, see "check_path_end_parity")
+
+        // with 1 pair, the max flow is only a question of connectivity, the flood fill is enough (see utils.c > "get_region_mask")
+        if (nb_of_pairs == 1)
+        {
+            if (!(get_region_mask(((uint32_t)1) << end_bit_idx_array[0], free_tile_mask) & (((uint32_t)1) << end_bit_idx_array[1])))
+                return false;
+            continue;
+        }
+
+        // 2) and 3) : bit k of half_mask set <=> end k + 1 is a start (nb_of_pairs starts with the first end)
+        can_ends_be_linked = false;
+        for (half_mask = 0; half_mask < (1 << (nb_of_ends - 1)) && !can_ends_be_linked; half_mask++)
+        {
+            if (NB_OF_TILES_IN_MASK(half_mask) != nb_of_pairs - 1)
+                continue;
+
+            source_tile_mask = ((uint32_t)1) << end_bit_idx_array[0];
+            for (end_idx = 1; end_idx < nb_of_ends; end_idx++)
+                if (half_mask & (1 << (end_idx - 1)))
+                    source_tile_mask |= ((uint32_t)1) << end_bit_idx_array[end_idx];
+
+            can_ends_be_linked = (get_max_nb_of_disjoint_paths(free_tile_mask, source_tile_mask, end_tile_mask & ~source_tile_mask, nb_of_pairs) == nb_of_pairs);
+        }
+
+        if (!can_ends_be_linked)
+            return false;
+    }
+
+    return true;
+}
+
+// Function to print how many boards the disjoint paths check has cut at each depth, out of the ones it has checked, on the current line (see SolverContext)
+void print_disjoint_paths_check_stats(SolverContext *context)
+{
+    printf("disjoint paths cuts / calls per depth :");
+    for (int depth = 0; depth <= NB_OF_PIECES; depth++)
+        printf(" %lld/%lld", context->disjoint_paths_check_nb_of_cuts_array[depth], context->disjoint_paths_check_nb_of_calls_array[depth]);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 // Function that checks if board double missing connections flags and positions are compatible after adding a piece
 // Returns true if it is, else false
 static bool check_double_missing_connections(Board *board)
@@ -415,7 +758,7 @@ static bool check_double_missing_connections(Board *board)
 // As soon as one of the check doesn't pass, function discards all other computation and returns the corresponding error code (see check_board.h)
 // Let the more likely and easy-to-compute checks be in first to cut down more computation
 // Returns int error_code based on the check that didn't pass else true (1)
-int run_all_checks(Board *board, bool enable_not_worth_checks)
+int run_all_checks(Board *board, SolverContext *context, bool enable_not_worth_checks)
 {
 
     // enable_not_worth_checks is a flag that let all the implemented checking methods run if true
@@ -423,19 +766,37 @@ int run_all_checks(Board *board, bool enable_not_worth_checks)
     // but particular checks are not worth doing when we are trying to solve the puzzle in the less amount of time possible
     // (they are more computation time to the evaluation of each board state, than they save by reducing the number of explored board states).
 
-    static Piece *last_added_piece = NULL;
-
-    last_added_piece = (board->piece_array) + board->added_piece_idx_array[board->nb_of_added_pieces - 1];
-
-    if (!check_isolated_tiles_around_piece(board, last_added_piece))
+    if (!check_colour_imbalance(board))
+        return COLOUR_IMBALANCE_NOT_FILLABLE;
+    if (!check_tile_type_budget(board))
+        return TILE_TYPES_NOT_FILLABLE;
+    if (!check_isolated_tiles_around_piece(board))
         return ISOLATED_EMPTY_TILE;
-
-    if (!check_no_dead_ends(board))
+    if (!check_region_sizes(board))
+        return REGION_SIZES_NOT_FILLABLE;
+    if (!check_small_region_shapes(board))
+        return SMALL_REGION_NOT_FILLABLE;
+    if (!check_path_end_parity(board))
+        return ODD_NB_OF_PATH_ENDS;
+
+    // (the previous pathfinding version is kept to benchmark them against each other, see batch_solver.c > "--compare-engines --engine astar")
+    if (context->check_settings.use_astar_dead_end_check ? !check_no_dead_ends_with_astar(board, context) : !check_no_dead_ends(board))
         return DEAD_END;
 
+    // only at the depths where it's worth it (see check_board.h)
+    if (enable_not_worth_checks || (board->nb_of_added_pieces >= context->check_settings.first_disjoint_paths_check_depth && board->nb_of_added_pieces <= context->check_settings.last_disjoint_paths_check_depth))
+    {
+        context->disjoint_paths_check_nb_of_calls_array[board->nb_of_added_pieces]++;
+        if (!check_disjoint_paths(board))
+        {
+            context->disjoint_paths_check_nb_of_cuts_array[board->nb_of_added_pieces]++;
+            return PATH_ENDS_NOT_LINKABLE;
+        }
+    }
+
     if (!check_double_missing_connections(board))
         return DOUBLE_MISSING_CONNECTION_NOT_FILLABLE;
-    if (!check_no_loops(board, last_added_piece))
+    if (!check_no_loops(board))
         return LOOP_PATH;
 
     return 1;
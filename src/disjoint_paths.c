@@ -0,0 +1,204 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file disjoint_paths.c
+ *
+ * Max flow on the graph of the free tiles of the board, with a capacity of 1 per tile
+ * It is needed in check_board.c > "check_disjoint_paths" : 2 future paths can't go through the same tile (a tile has at most 2 connections)
+ *
+ * Explanation :
+ *
+ *      The max number of paths from the source tiles to the sink tiles, that don't share any tile, is a max flow where each tile can only carry 1 unit of flow.
+ *      As usual, each tile is split in 2 nodes : "in" and "out", linked by an arc of capacity 1, and the arcs between neighbour tiles go from "out" to "in".
+ *      The flow is then increased 1 path at a time (Ford-Fulkerson), each augmenting path being found with a breadth first search on the residual graph.
+ *
+ *      The graph is at most 64 nodes, so everything is kept in bitboards (see utils.h > bitboard stuff) :
+ *      the flow on the arcs of tile "bit_idx" is bit "bit_idx" of a few masks, there is nothing to allocate.
+ */
+
+#include <stdbool.h>
+#include <stdint.h> // uint32_t
+
+#include <local/utils.h> // bitboard macros, Direction and defines
+
+#include <local/disjoint_paths.h>
+
+// a node of the graph is (tile, side) : node_idx = bit_idx * 2 + side
+#define IN_SIDE 0
+#define OUT_SIDE 1
+#define NB_OF_NODES (BOARD_TOTAL_NB_TILES * 2)
+#define NO_NODE -1
+
+#define NODE_IDX(bit_idx, side) ((bit_idx) * 2 + (side))
+#define NODE_BIT_IDX(node_idx) ((node_idx) / 2)
+#define NODE_SIDE(node_idx) ((node_idx) % 2)
+
+#define BIT_MASK(bit_idx) (((uint32_t)1) << (bit_idx))
+
+/**
+ * @struct TileFlow
+ * Current flow of the graph
+ */
+typedef struct TileFlow
+{
+    uint32_t tile_flow_mask;                        // bit set <=> the arc "in" -> "out" of the tile carries flow
+    uint32_t arc_flow_mask_array[NB_OF_DIRECTIONS]; // bit set <=> the arc from "out" of the tile to "in" of its neighbour in the direction carries flow
+    uint32_t source_flow_mask;                      // bit set <=> a path starts on the tile
+    uint32_t sink_flow_mask;                        // bit set <=> a path ends on the tile
+
+} TileFlow;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// Returns the bit index of the neighbour of a tile in a direction, -1 if it is outside of the board
+// (same as utils.c > "increment_pos_in_direction" then "is_pos_inside_board", directly on bit indexes, see utils.h > bitboard stuff)
+static int get_neighbour_bit_idx(int bit_idx, Direction direction)
+{
+    switch (direction)
+    {
+    case RIGHT:
+        return (bit_idx + BOARD_HEIGHT < BOARD_TOTAL_NB_TILES) ? bit_idx + BOARD_HEIGHT : -1;
+    case LEFT:
+        return (bit_idx >= BOARD_HEIGHT) ? bit_idx - BOARD_HEIGHT : -1;
+    case DOWN:
+        return (bit_idx % BOARD_HEIGHT != BOARD_HEIGHT - 1) ? bit_idx + 1 : -1;
+    default: // UP
+        return (bit_idx % BOARD_HEIGHT != 0) ? bit_idx - 1 : -1;
+    }
+}
+
+// Returns the direction to go from a tile to its neighbour
+static Direction get_neighbour_direction(int bit_idx, int neighbour_bit_idx)
+{
+    Direction direction;
+
+    for (direction = 0; direction < NB_OF_DIRECTIONS - 1; direction++)
+        if (get_neighbour_bit_idx(bit_idx, direction) == neighbour_bit_idx)
+            break;
+
+    return direction;
+}
+
+// Function to push the flow of 1 more path along the augmenting path ending on "node_idx" (see "find_augmenting_path")
+// Forward arcs of the residual graph get flow, and backward arcs cancel the flow of the matching arc
+static void push_flow(TileFlow *flow, int parent_node_idx_array[NB_OF_NODES], int node_idx)
+{
+    int parent_node_idx, bit_idx, parent_bit_idx;
+
+    flow->sink_flow_mask |= BIT_MASK(NODE_BIT_IDX(node_idx));
+
+    for (parent_node_idx = parent_node_idx_array[node_idx]; parent_node_idx != NO_NODE; node_idx = parent_node_idx, parent_node_idx = parent_node_idx_array[node_idx])
+    {
+        bit_idx = NODE_BIT_IDX(node_idx);
+        parent_bit_idx = NODE_BIT_IDX(parent_node_idx);
+
+        if (bit_idx == parent_bit_idx)
+        {
+            // "in" -> "out" of the same tile, or back
+            if (NODE_SIDE(node_idx) == OUT_SIDE)
+                flow->tile_flow_mask |= BIT_MASK(bit_idx);
+            else
+                flow->tile_flow_mask &= ~BIT_MASK(bit_idx);
+        }
+        else if (NODE_SIDE(node_idx) == IN_SIDE)
+            // "out" of a tile -> "in" of its neighbour
+            flow->arc_flow_mask_array[get_neighbour_direction(parent_bit_idx, bit_idx)] |= BIT_MASK(parent_bit_idx);
+        else
+            // "in" of a tile -> back to "out" of the neighbour that was sending flow to it
+            flow->arc_flow_mask_array[get_neighbour_direction(bit_idx, parent_bit_idx)] &= ~BIT_MASK(bit_idx);
+    }
+
+    flow->source_flow_mask |= BIT_MASK(NODE_BIT_IDX(node_idx));
+}
+
+// Function to find a path from a free source tile to a free sink tile in the residual graph, with a breadth first search, and to push 1 unit of flow along it
+// Returns true if the flow has been increased
+static bool find_augmenting_path(TileFlow *flow, uint32_t free_tile_mask, uint32_t source_tile_mask, uint32_t sink_tile_mask)
+{
+    int parent_node_idx_array[NB_OF_NODES];
+    int node_queue[NB_OF_NODES];
+    int queue_start = 0, queue_end = 0;
+    uint32_t visited_tile_mask_array[2] = {0, 0}; // per side
+    uint32_t remaining_tile_mask;
+    int node_idx, bit_idx, neighbour_bit_idx;
+    Direction direction;
+
+// helper macro to add a node to the queue, only the first time it is reached
+#define VISIT_NODE(new_bit_idx, side, parent)                                      \
+    do                                                                            \
+    {                                                                             \
+        if (!(visited_tile_mask_array[(side)] & BIT_MASK(new_bit_idx)))           \
+        {                                                                         \
+            visited_tile_mask_array[(side)] |= BIT_MASK(new_bit_idx);             \
+            parent_node_idx_array[NODE_IDX((new_bit_idx), (side))] = (parent);    \
+            node_queue[queue_end++] = NODE_IDX((new_bit_idx), (side));            \
+        }                                                                         \
+    } while (0)
+
+    // a path can start on every source tile that isn't already the start of a path
+    for (remaining_tile_mask = source_tile_mask & ~(flow->source_flow_mask); remaining_tile_mask; remaining_tile_mask &= remaining_tile_mask - 1)
+        VISIT_NODE(LOWEST_BIT_IDX(remaining_tile_mask), IN_SIDE, NO_NODE);
+
+    while (queue_start < queue_end)
+    {
+        node_idx = node_queue[queue_start++];
+        bit_idx = NODE_BIT_IDX(node_idx);
+
+        if (NODE_SIDE(node_idx) == IN_SIDE)
+        {
+            // through the tile, if it doesn't carry flow yet
+            if (!(flow->tile_flow_mask & BIT_MASK(bit_idx)))
+                VISIT_NODE(bit_idx, OUT_SIDE, node_idx);
+
+            // back to the neighbour that sends flow to this tile
+            for (direction = 0; direction < NB_OF_DIRECTIONS; direction++)
+            {
+                neighbour_bit_idx = get_neighbour_bit_idx(bit_idx, reverse_direction(direction));
+                if (neighbour_bit_idx >= 0 && (flow->arc_flow_mask_array[direction] & BIT_MASK(neighbour_bit_idx)))
+                    VISIT_NODE(neighbour_bit_idx, OUT_SIDE, node_idx);
+            }
+            continue;
+        }
+
+        // a path can end on every sink tile that isn't already the end of a path
+        if ((sink_tile_mask & ~(flow->sink_flow_mask)) & BIT_MASK(bit_idx))
+        {
+            push_flow(flow, parent_node_idx_array, node_idx);
+            return true;
+        }
+
+        // back through the tile, if it carries flow
+        if (flow->tile_flow_mask & BIT_MASK(bit_idx))
+            VISIT_NODE(bit_idx, IN_SIDE, node_idx);
+
+        // to the free neighbours
+        for (direction = 0; direction < NB_OF_DIRECTIONS; direction++)
+        {
+            neighbour_bit_idx = get_neighbour_bit_idx(bit_idx, direction);
+            if (neighbour_bit_idx >= 0 && (free_tile_mask & BIT_MASK(neighbour_bit_idx)) && !(flow->arc_flow_mask_array[direction] & BIT_MASK(bit_idx)))
+                VISIT_NODE(neighbour_bit_idx, IN_SIDE, node_idx);
+        }
+    }
+
+#undef VISIT_NODE
+
+    return false;
+}
+
+// -------------- Main function ---------------------------------------------------------------------------------
+
+// Function to compute the max number of paths from the source tiles to the sink tiles, that only go through the free tiles and don't share any tile
+// (source and sink tiles must be free tiles, and a tile can't be both)
+// The computation stops as soon as "nb_of_paths_needed" paths have been found
+// Returns the number of paths found
+int get_max_nb_of_disjoint_paths(uint32_t free_tile_mask, uint32_t source_tile_mask, uint32_t sink_tile_mask, int nb_of_paths_needed)
+{
+    TileFlow flow = {0};
+    int nb_of_paths = 0;
+
+    while (nb_of_paths < nb_of_paths_needed && find_augmenting_path(&flow, free_tile_mask, source_tile_mask & free_tile_mask, sink_tile_mask & free_tile_mask))
+        nb_of_paths++;
+
+    return nb_of_paths;
+}
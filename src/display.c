@@ -15,19 +15,20 @@
  * At each different main data drawing section there is :
  * 1) Function to compute cache drawing data, used only when they need to be updated, thus called once in a while (e.g : piece moving on the board -> time to update its drawing)
  * 2) Function to effectively draw the cached data (which is called in repeat, in classic drawing loops)
+ * The cached drawing data is kept in a BoardDrawing (see display.h) allocated next to the drawn board, not in the Tile, Piece and Board structs used by the solver
  *
  */
 
 #include <stdbool.h>
 #include <stdio.h>  // sprintf
-#include <stdlib.h> // NULL
+#include <stdlib.h> // NULL, calloc
 
 #define RAYGUI_IMPLEMENTATION
 #include <raylib/raygui.h>
 #include <raylib/raylib.h> // Color, primary drawing functions, and defines
 
 #include <local/utils.h>       // Vector2_int, Directoin, helper functions, and defines
-#include <local/piece_data.h>  // Tile, Side, Piece, and defines
+#include <local/piece_data.h>  // Tile, Side, Piece, side_border_tile_relative_pos_array, and defines
 #include <local/piece.h>       // blit_piece_main_data
 #include <local/board.h>       // Board, and defines
 #include <local/check_board.h> // defines
@@ -163,6 +164,137 @@ static void DrawLineStripEx(Vector2 *points, int pointCount, float thick, Color
         DrawLineEx(points[i], points[i + 1], thick, color);
 }
 
+// -----------------------------------------------------------------------------------------------------------------------------------------------
+// --------------------------------- Drawing data ------------------------------------------------------------------------------------------------
+// -----------------------------------------------------------------------------------------------------------------------------------------------
+
+// Drawing data is not cached inside Tile, Piece and Board structs (they are the solver data, and headless solving never draws anything)
+// but in a BoardDrawing (see display.h) that is allocated next to the board that is drawn, and filled by the update drawing functions
+
+#define NB_OF_GRID_LINES (BOARD_WIDTH + BOARD_HEIGHT + 2)
+
+static Vector2 grid_lines_pt_array[NB_OF_GRID_LINES][2]; // the grid only depends on offset_px, it is the same for every board
+
+// Data of the pieces that is only used to draw them, kept out of the Piece struct (see piece_data.h) for the same reason
+typedef struct PieceDrawingDefinition
+{
+    const char *name;
+    int piece_height;        // vertical space taken by the piece in its default orientation (in number of tiles), useful to draw_piece_priority_array
+    int nb_of_outline_tiles; // length of matching arrays (which is common between sides of the same piece)
+    // array of relative pos of tiles which have their top-left corners used to draw an outline around the piece, per side
+    Vector2_int outline_tile_relative_pos_array[MAX_NB_OF_SIDE_PER_PIECE][MAX_NB_OF_OUTLINE_POINTS];
+
+} PieceDrawingDefinition;
+
+// indexed by piece_idx (see Piece::piece_idx)
+static const PieceDrawingDefinition piece_drawing_definition_array[NB_OF_PIECES] = {
+    [LINE2_1] = {
+        .name = "Line2 1",
+        .piece_height = 1,
+        .nb_of_outline_tiles = 5,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [LINE2_2] = {
+        .name = "Line2 2",
+        .piece_height = 1,
+        .nb_of_outline_tiles = 5,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [LINE3_1] = {
+        .name = "Line3 1",
+        .piece_height = 1,
+        .nb_of_outline_tiles = 5,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [LINE3_2] = {
+        .name = "Line3 2",
+        .piece_height = 1,
+        .nb_of_outline_tiles = 5,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+            {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [CORNER_1] = {
+        .name = "Corner 1",
+        .piece_height = 2,
+        .nb_of_outline_tiles = 7,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 0}},
+            {{0, 0}, {1, 0}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [CORNER_2] = {
+        .name = "Corner 2",
+        .piece_height = 2,
+        .nb_of_outline_tiles = 7,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 0}},
+            {{0, 0}, {1, 0}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
+        },
+    },
+    [SQUARE] = {
+        .name = "Square",
+        .piece_height = 2,
+        .nb_of_outline_tiles = 5,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}},
+            {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}},
+        },
+    },
+    [L_PIECE] = {
+        .name = "L piece",
+        .piece_height = 3,
+        .nb_of_outline_tiles = 7,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {1, 0}, {1, 2}, {2, 2}, {2, 3}, {0, 3}, {0, 0}},
+            {{0, 0}, {1, 0}, {1, 3}, {-1, 3}, {-1, 2}, {0, 2}, {0, 0}},
+        },
+    },
+    [T_PIECE] = {
+        .name = "T piece",
+        .piece_height = 2,
+        .nb_of_outline_tiles = 9,
+        .outline_tile_relative_pos_array = {
+            {{-1, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
+            {{-1, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
+        },
+    },
+    [Z_PIECE] = {
+        .name = "Z piece",
+        .piece_height = 2,
+        .nb_of_outline_tiles = 9,
+        .outline_tile_relative_pos_array = {
+            {{0, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
+            {{-1, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
+        },
+    },
+};
+
+const char *get_piece_name(int piece_idx)
+{
+    return piece_drawing_definition_array[piece_idx].name;
+}
+
+// BoardDrawing constructor, to free with the board (plain free)
+BoardDrawing *init_board_drawing(void)
+{
+    return calloc(1, sizeof(BoardDrawing));
+}
+
 // -----------------------------------------------------------------------------------------------------------------------------------------------
 // ---------------------------------Main elementary drawing sub functions ------------------------------------------------------------------------
 // -----------------------------------------------------------------------------------------------------------------------------------------------
@@ -202,7 +334,7 @@ void draw_grid()
     }
 }
 
-static void update_board_grid_drawing(Board *board)
+static void update_board_grid_drawing(void)
 {
     float pt_x, pt_y, pt1_y, pt2_y, pt1_x, pt2_x;
     int current_point_couple_idx = 0;
@@ -212,10 +344,10 @@ static void update_board_grid_drawing(Board *board)
         pt1_y = offset_px.j;
         pt2_y = (BOARD_HEIGHT * tile_px_width) + offset_px.j;
 
-        board->grid_lines_pt_array[current_point_couple_idx][0].x = pt_x;
-        board->grid_lines_pt_array[current_point_couple_idx][0].y = pt1_y;
-        board->grid_lines_pt_array[current_point_couple_idx][1].x = pt_x;
-        board->grid_lines_pt_array[current_point_couple_idx][1].y = pt2_y;
+        grid_lines_pt_array[current_point_couple_idx][0].x = pt_x;
+        grid_lines_pt_array[current_point_couple_idx][0].y = pt1_y;
+        grid_lines_pt_array[current_point_couple_idx][1].x = pt_x;
+        grid_lines_pt_array[current_point_couple_idx][1].y = pt2_y;
 
         current_point_couple_idx++;
     }
@@ -225,103 +357,110 @@ static void update_board_grid_drawing(Board *board)
         pt1_x = offset_px.i;
         pt2_x = (BOARD_WIDTH * tile_px_width) + offset_px.i;
 
-        board->grid_lines_pt_array[current_point_couple_idx][0].x = pt1_x;
-        board->grid_lines_pt_array[current_point_couple_idx][0].y = pt_y;
-        board->grid_lines_pt_array[current_point_couple_idx][1].x = pt2_x;
-        board->grid_lines_pt_array[current_point_couple_idx][1].y = pt_y;
+        grid_lines_pt_array[current_point_couple_idx][0].x = pt1_x;
+        grid_lines_pt_array[current_point_couple_idx][0].y = pt_y;
+        grid_lines_pt_array[current_point_couple_idx][1].x = pt2_x;
+        grid_lines_pt_array[current_point_couple_idx][1].y = pt_y;
 
         current_point_couple_idx++;
     }
 }
 
-static void draw_board_grid(Board *board)
+static void draw_board_grid(void)
 {
     static int i;
     for (i = 0; i < NB_OF_GRID_LINES; i++)
-        DrawLineEx(board->grid_lines_pt_array[i][0], board->grid_lines_pt_array[i][1], grid_line_px_thick, GRAY);
+        DrawLineEx(grid_lines_pt_array[i][0], grid_lines_pt_array[i][1], grid_line_px_thick, GRAY);
 }
 
 // --------------------------- Functions to draw normal and missing_connection tiles  ------------------------------------------------------------
 
-static void update_tile_drawing(Tile *tile)
+static void update_tile_drawing(const Tile *tile, TileDrawing *tile_drawing)
 {
     static int idx;
     static Direction connection_direction;
 
-    tile->top_left_corner_pt.i = (tile->absolute_pos.i * current_tile_px_width) + offset_px.i;
-    tile->top_left_corner_pt.j = (tile->absolute_pos.j * current_tile_px_width) + offset_px.j;
+    tile_drawing->top_left_corner_pt.i = (tile->absolute_pos.i * current_tile_px_width) + offset_px.i;
+    tile_drawing->top_left_corner_pt.j = (tile->absolute_pos.j * current_tile_px_width) + offset_px.j;
 
-    tile->center_pt.x = tile->top_left_corner_pt.i + current_tile_px_width / 2;
-    tile->center_pt.y = tile->top_left_corner_pt.j + current_tile_px_width / 2;
+    tile_drawing->center_pt.x = tile_drawing->top_left_corner_pt.i + current_tile_px_width / 2;
+    tile_drawing->center_pt.y = tile_drawing->top_left_corner_pt.j + current_tile_px_width / 2;
 
     for (idx = 0; idx < tile->nb_of_connections; idx++)
     {
         connection_direction = tile->connection_direction_array[idx];
-        tile->connection_pt_array[idx].x = tile->center_pt.x + current_connections_tip_offset[connection_direction].i;
-        tile->connection_pt_array[idx].y = tile->center_pt.y + current_connections_tip_offset[connection_direction].j;
+        tile_drawing->connection_pt_array[idx].x = tile_drawing->center_pt.x + current_connections_tip_offset[connection_direction].i;
+        tile_drawing->connection_pt_array[idx].y = tile_drawing->center_pt.y + current_connections_tip_offset[connection_direction].j;
     }
 }
 
-static void draw_tile_color(Tile *tile, Color connection_color)
+static void draw_tile_color(const Tile *tile, const TileDrawing *tile_drawing, Color connection_color)
 {
     static int i;
     for (i = 0; i < tile->nb_of_connections; i++)
     {
-        DrawLineEx(tile->center_pt, tile->connection_pt_array[i], current_connection_line_px_thick, connection_color);
+        DrawLineEx(tile_drawing->center_pt, tile_drawing->connection_pt_array[i], current_connection_line_px_thick, connection_color);
     }
 
     if (tile->tile_type == bend)
     {
-        DrawCircle((int)tile->center_pt.x, (int)tile->center_pt.y, current_bend_circle_radius, connection_color);
+        DrawCircle((int)tile_drawing->center_pt.x, (int)tile_drawing->center_pt.y, current_bend_circle_radius, connection_color);
     }
     else if (tile->tile_type == point)
     {
-        DrawCircle((int)tile->center_pt.x, (int)tile->center_pt.y, current_point_circle_radius, connection_color);
+        DrawCircle((int)tile_drawing->center_pt.x, (int)tile_drawing->center_pt.y, current_point_circle_radius, connection_color);
     }
 
-    DrawRectangleLines(tile->top_left_corner_pt.i, tile->top_left_corner_pt.j, current_tile_px_width, current_tile_px_width, WHITE);
+    DrawRectangleLines(tile_drawing->top_left_corner_pt.i, tile_drawing->top_left_corner_pt.j, current_tile_px_width, current_tile_px_width, WHITE);
 }
 
 // shortcut to draw normal tiles with connection color : gold
 // see draw_tile_color
-static void draw_tile(Tile *tile)
+static void draw_tile(const Tile *tile, const TileDrawing *tile_drawing)
 {
-    draw_tile_color(tile, connection_line_color);
+    draw_tile_color(tile, tile_drawing, connection_line_color);
 }
 
 // shortcut to draw missing connection tiles with connection color : red
 // see draw_tile_color
 // these are separate functions, because I might only use it to debug the data and not use it in the main visualization
-static void draw_missing_connection_tile(Tile *tile)
+static void draw_missing_connection_tile(const Tile *tile, const TileDrawing *tile_drawing)
 {
-    draw_tile_color(tile, RED);
+    draw_tile_color(tile, tile_drawing, RED);
 }
 // --------------------------- Functions to draw border tiles (used only in debugging, see test_display.c)  --------------------------------------------
 
-static void update_piece_border_tiles_drawing(Piece *piece)
+// Function to blit only border tiles of piece at the right position in the board, for display (the solver only uses them through Placement::border_tile_mask)
+static void update_piece_border_tiles_drawing(Piece *piece, PieceDrawing *piece_drawing)
 {
+    static Vector2_int temp_pos;
 
     for (int idx = 0; idx < piece->nb_of_border_tiles; idx++)
     {
-        if (!is_pos_valid(&(piece->border_tile_absolute_pos_array[idx])))
+        temp_pos = side_border_tile_relative_pos_array[piece->piece_idx][piece->current_side_idx][idx];
+        rotate_pos(&temp_pos, piece->current_rotation_state);
+        translate_pos(&temp_pos, &(piece->current_base_pos));
+
+        if (!is_pos_inside_board(&temp_pos))
         {
-            set_invalid_pos(&(piece->border_tile_effective_absolute_top_left_corner_pt_array[idx]));
+            set_invalid_pos(&(piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx]));
             continue;
         }
-        piece->border_tile_effective_absolute_top_left_corner_pt_array[idx].i = (piece->border_tile_absolute_pos_array[idx].i * current_tile_px_width) + offset_px.i;
-        piece->border_tile_effective_absolute_top_left_corner_pt_array[idx].j = (piece->border_tile_absolute_pos_array[idx].j * current_tile_px_width) + offset_px.j;
+        piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx].i = (temp_pos.i * current_tile_px_width) + offset_px.i;
+        piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx].j = (temp_pos.j * current_tile_px_width) + offset_px.j;
     }
 }
 
-void draw_piece_border_tiles(Piece *piece)
+static void draw_piece_border_tiles(Piece *piece, PieceDrawing *piece_drawing)
 {
     static Rectangle rec;
+
     for (int idx = 0; idx < piece->nb_of_border_tiles; idx++)
     {
-        if (!is_pos_valid(&(piece->border_tile_effective_absolute_top_left_corner_pt_array[idx])))
+        if (!is_pos_valid(&(piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx])))
             continue;
-        rec.x = (float)(piece->border_tile_effective_absolute_top_left_corner_pt_array[idx].i);
-        rec.y = (float)(piece->border_tile_effective_absolute_top_left_corner_pt_array[idx].j);
+        rec.x = (float)(piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx].i);
+        rec.y = (float)(piece_drawing->border_tile_effective_absolute_top_left_corner_pt_array[idx].j);
         rec.width = (float)current_tile_px_width;
         rec.height = (float)current_tile_px_width;
 
@@ -334,13 +473,13 @@ void draw_piece_border_tiles(Piece *piece)
 static Vector2_int outline_edge_correction_values[] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
 
 // Function to blit only outline edge points of side at the right emplacement in the board for display
-static void update_piece_outline_drawing(Piece *piece)
+static void update_piece_outline_drawing(Piece *piece, PieceDrawing *piece_drawing)
 {
-    static Side *side = NULL;
+    static const PieceDrawingDefinition *definition = NULL;
     static Vector2_int temp_pos;
     static int i;
 
-    side = (piece->side_array) + (piece->current_side_idx);
+    definition = piece_drawing_definition_array + piece->piece_idx;
 
     // why do the tile emplacements need a correction after the classic rotation / translation of relative positions ?
     // it's because the drawing function is assuming that when we pass her tile positions, we take the top-left corner of each to draw the outline edge of a piece
@@ -348,10 +487,10 @@ static void update_piece_outline_drawing(Piece *piece)
     // for example : when we rotate 90° clockwise (: rotation_state=1), we want to take the top-right corner of each specified tile position (after classic placement computation)
     // so we take instead the top-left corner of their right neighbour (translation (1,0) for each position)
 
-    for (i = 0; i < piece->nb_of_outline_tiles; i++)
+    for (i = 0; i < definition->nb_of_outline_tiles; i++)
     {
         // classic tile placement
-        temp_pos = side->outline_tile_relative_pos_array[i];
+        temp_pos = definition->outline_tile_relative_pos_array[piece->current_side_idx][i];
         rotate_pos(&temp_pos, piece->current_rotation_state);
         translate_pos(&temp_pos, &(piece->current_base_pos));
 
@@ -359,114 +498,119 @@ static void update_piece_outline_drawing(Piece *piece)
         translate_pos(&temp_pos, &(outline_edge_correction_values[piece->current_rotation_state]));
 
         // Final data used in draw_piece_outline
-        piece->outline_tile_effective_absolute_top_left_corner_pt_array[i].x = (temp_pos.i * current_tile_px_width) + offset_px.i;
-        piece->outline_tile_effective_absolute_top_left_corner_pt_array[i].y = (temp_pos.j * current_tile_px_width) + offset_px.j;
+        piece_drawing->outline_tile_effective_absolute_top_left_corner_pt_array[i].x = (temp_pos.i * current_tile_px_width) + offset_px.i;
+        piece_drawing->outline_tile_effective_absolute_top_left_corner_pt_array[i].y = (temp_pos.j * current_tile_px_width) + offset_px.j;
     }
 }
 
-static void draw_piece_outline(Piece *piece)
+static void draw_piece_outline(Piece *piece, PieceDrawing *piece_drawing)
 {
-    DrawLineStripEx(piece->outline_tile_effective_absolute_top_left_corner_pt_array, piece->nb_of_outline_tiles, current_outline_px_thick, outline_color);
+    DrawLineStripEx(piece_drawing->outline_tile_effective_absolute_top_left_corner_pt_array, piece_drawing_definition_array[piece->piece_idx].nb_of_outline_tiles, current_outline_px_thick, outline_color);
 }
 
 // ---------------------------------------------------------------------------------------------------------------
 // ---------------------------------- Convenience functions ------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------
 
-static void update_tile_array_drawing(Tile *tile_array, int nb_of_tiles)
+static void update_tile_array_drawing(const Tile *tile_array, TileDrawing *tile_drawing_array, int nb_of_tiles)
 {
     static int i;
     for (i = 0; i < nb_of_tiles; i++)
-        update_tile_drawing(tile_array + i);
+        update_tile_drawing(tile_array + i, tile_drawing_array + i);
 }
 
-static void draw_tile_array(Tile *tile_array, int nb_of_tiles)
+static void draw_tile_array(const Tile *tile_array, const TileDrawing *tile_drawing_array, int nb_of_tiles)
 {
     static int i;
     for (i = 0; i < nb_of_tiles; i++)
-        draw_tile(tile_array + i);
+        draw_tile(tile_array + i, tile_drawing_array + i);
 }
 
-static void draw_missing_connection_tile_array(Tile *tile_array, int nb_of_tiles)
+static void draw_missing_connection_tile_array(const Tile *tile_array, const TileDrawing *tile_drawing_array, int nb_of_tiles)
 {
     static int i;
     for (i = 0; i < nb_of_tiles; i++)
-        draw_missing_connection_tile(tile_array + i);
+        draw_missing_connection_tile(tile_array + i, tile_drawing_array + i);
 }
 
 // ----------------------
 
-static void update_piece_tiles_drawing(Piece *piece, bool show_missing_connection_tiles)
+static void update_piece_tiles_drawing(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles)
 {
     static Side *side = NULL;
     side = (piece->side_array) + piece->current_side_idx;
 
-    update_tile_array_drawing(side->tile_array, side->nb_of_tiles);
+    update_tile_array_drawing(side->tile_array, piece_drawing->tile_drawing_array, side->nb_of_tiles);
     if (show_missing_connection_tiles)
-        update_tile_array_drawing(side->missing_connection_tile_array, side->nb_of_missing_connection_tiles);
+        update_tile_array_drawing(side->missing_connection_tile_array, piece_drawing->missing_connection_tile_drawing_array, side->nb_of_missing_connection_tiles);
 }
 
-static void update_board_obligatory_tiles_drawing(Board *board)
+static void update_board_obligatory_tiles_drawing(Board *board, BoardDrawing *board_drawing)
 {
-    update_tile_array_drawing(board->obligatory_tile_array, board->nb_of_obligatory_tiles);
+    update_tile_array_drawing(board->obligatory_tile_array, board_drawing->obligatory_tile_drawing_array, board->nb_of_obligatory_tiles);
 }
 
-static void draw_piece_tiles(Piece *piece, bool show_missing_connection_tiles)
+static void draw_piece_tiles(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles)
 {
     static Side *side = NULL;
     side = (piece->side_array) + piece->current_side_idx;
 
-    draw_tile_array(side->tile_array, side->nb_of_tiles);
+    draw_tile_array(side->tile_array, piece_drawing->tile_drawing_array, side->nb_of_tiles);
     if (show_missing_connection_tiles)
-        draw_missing_connection_tile_array(side->missing_connection_tile_array, side->nb_of_missing_connection_tiles);
+        draw_missing_connection_tile_array(side->missing_connection_tile_array, piece_drawing->missing_connection_tile_drawing_array, side->nb_of_missing_connection_tiles);
 }
 
 // ----------------------
 
-void update_piece_all_drawing(Piece *piece, bool show_missing_connection_tiles, bool show_border_tiles)
+void update_piece_all_drawing(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles, bool show_border_tiles)
 {
-    update_piece_tiles_drawing(piece, show_missing_connection_tiles);
-    update_piece_outline_drawing(piece);
+    update_piece_tiles_drawing(piece, piece_drawing, show_missing_connection_tiles);
+    update_piece_outline_drawing(piece, piece_drawing);
     if (show_border_tiles)
-        update_piece_border_tiles_drawing(piece);
+        update_piece_border_tiles_drawing(piece, piece_drawing);
 }
 
-void draw_piece(Piece *piece, bool show_missing_connection_tiles, bool show_border_tiles)
+void draw_piece(Piece *piece, PieceDrawing *piece_drawing, bool show_missing_connection_tiles, bool show_border_tiles)
 {
 
-    draw_piece_tiles(piece, show_missing_connection_tiles);
+    draw_piece_tiles(piece, piece_drawing, show_missing_connection_tiles);
 
     if (show_border_tiles)
-        draw_piece_border_tiles(piece);
+        draw_piece_border_tiles(piece, piece_drawing);
 
-    draw_piece_outline(piece);
+    draw_piece_outline(piece, piece_drawing);
 }
 
 // ----------------------
 
-void update_board_static_drawing(Board *board)
+void update_board_static_drawing(Board *board, BoardDrawing *board_drawing)
 {
-    update_board_grid_drawing(board);
-    update_board_obligatory_tiles_drawing(board);
+    static int piece_idx;
+
+    update_board_grid_drawing();
+    update_board_obligatory_tiles_drawing(board, board_drawing);
 
     for (int i = 0; i < board->nb_of_added_pieces; i++)
-        update_piece_all_drawing((board->piece_array) + board->added_piece_idx_array[i], false, false);
+    {
+        piece_idx = board->added_piece_idx_array[i];
+        update_piece_all_drawing((board->piece_array) + piece_idx, (board_drawing->piece_drawing_array) + piece_idx, false, false);
+    }
 }
 
-void draw_board(Board *board)
+void draw_board(Board *board, BoardDrawing *board_drawing)
 {
     static int i;
     static int piece_idx;
 
-    draw_board_grid(board);
+    draw_board_grid();
 
     for (i = 0; i < board->nb_of_obligatory_tiles; i++)
-        draw_tile_color((board->obligatory_tile_array + i), GRAY);
+        draw_tile_color((board->obligatory_tile_array + i), (board_drawing->obligatory_tile_drawing_array + i), GRAY);
 
     for (i = 0; i < board->nb_of_added_pieces; i++)
     {
         piece_idx = board->added_piece_idx_array[i];
-        draw_piece((board->piece_array) + piece_idx, false, false);
+        draw_piece((board->piece_array) + piece_idx, (board_drawing->piece_drawing_array) + piece_idx, false, false);
     }
 }
 
@@ -518,6 +662,8 @@ void draw_piece_priority_array(int piece_idx_priority_array[NB_OF_PIECES], int p
 {
     static Piece piece_priority_array[NB_OF_PIECES] = {0};
     static Piece piece_remaining_array[NB_OF_PIECES] = {0};
+    static PieceDrawing piece_priority_drawing_array[NB_OF_PIECES]; // drawing data of the pieces above, indexed by piece_idx
+    static PieceDrawing piece_remaining_drawing_array[NB_OF_PIECES];
 
     // to position the legend display to the bottom of the columns
     static Vector2_int priority_legend_pos;
@@ -579,19 +725,19 @@ void draw_piece_priority_array(int piece_idx_priority_array[NB_OF_PIECES], int p
 
             // Piece priority array update
             piece = piece_priority_array + piece_idx;
-            priority_base_pos.j -= piece->piece_height;
+            priority_base_pos.j -= piece_drawing_definition_array[piece_idx].piece_height;
             blit_piece_main_data(piece, side_idx, priority_base_pos, rotation_state);
             priority_base_pos.j--; // let a space of 1 small-tile between 2 pieces
-            update_piece_all_drawing(piece, false, false);
+            update_piece_all_drawing(piece, piece_priority_drawing_array + piece_idx, false, false);
 
             // Remaining pieces udpate
             if (i < piece_selected)
                 continue;
             piece = (piece_remaining_array) + piece_idx;
-            remaining_base_pos.j -= piece->piece_height;
+            remaining_base_pos.j -= piece_drawing_definition_array[piece_idx].piece_height;
             blit_piece_main_data(piece, side_idx, remaining_base_pos, rotation_state);
             remaining_base_pos.j--; // let a space of 1 small-tile between 2 pieces
-            update_piece_all_drawing(piece, false, false);
+            update_piece_all_drawing(piece, piece_remaining_drawing_array + piece_idx, false, false);
         }
     }
 
@@ -601,12 +747,12 @@ void draw_piece_priority_array(int piece_idx_priority_array[NB_OF_PIECES], int p
 
         // Piece priority array display
         piece = piece_priority_array + piece_idx;
-        draw_piece(piece, false, false);
+        draw_piece(piece, piece_priority_drawing_array + piece_idx, false, false);
 
         if (i < piece_selected)
             continue;
         piece = (piece_remaining_array) + piece_idx;
-        draw_piece(piece, false, false);
+        draw_piece(piece, piece_remaining_drawing_array + piece_idx, false, false);
     }
 
     // Restore normal drawing constants
@@ -703,7 +849,7 @@ bool draw_launch_button(void)
 }
 
 // Function to draw the result hint after adding a piece to the board in assisted mode
-//  make status + 10 if the error code come from "run_all_checks" instead of "add_piece_to_board"
+//  make status + POST_ADDING_CHECK_STATUS_OFFSET if the error code come from "run_all_checks" instead of "add_piece_to_board"
 void draw_board_validation(int status)
 {
 
@@ -740,19 +886,37 @@ void draw_board_validation(int status)
         DrawText("Board validation : Error ! A position is expecting 2 connections and can't", x, y, font_size, col);
         DrawText("be filled with remaining pieces", x, y + font_size + 1, font_size, col);
         break;
-    case 10 + ISOLATED_EMPTY_TILE:
+    case POST_ADDING_CHECK_STATUS_OFFSET + ISOLATED_EMPTY_TILE:
         DrawText("Board validation : Error ! One or more positions are isolated", x, y, font_size, col);
         break;
-    case 10 + DEAD_END:
+    case POST_ADDING_CHECK_STATUS_OFFSET + DEAD_END:
         DrawText("Board validation : Error ! There is a connection path dead end", x, y, font_size, col);
         break;
-    case 10 + DOUBLE_MISSING_CONNECTION_NOT_FILLABLE:
+    case POST_ADDING_CHECK_STATUS_OFFSET + DOUBLE_MISSING_CONNECTION_NOT_FILLABLE:
         DrawText("Board validation : Error ! A position is expecting 2 connections and can't", x, y, font_size, col);
         DrawText("be filled with remaining pieces", x, y + font_size + 1, font_size, col);
         break;
-    case 10 + LOOP_PATH:
+    case POST_ADDING_CHECK_STATUS_OFFSET + LOOP_PATH:
         DrawText("Board validation : Error ! There is a connection path loop (not allowed)", x, y, font_size, col);
         break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + REGION_SIZES_NOT_FILLABLE:
+        DrawText("Board validation : Error ! Empty regions can't be filled with remaining pieces", x, y, font_size, col);
+        break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + ODD_NB_OF_PATH_ENDS:
+        DrawText("Board validation : Error ! An empty region has a path end that can't be linked", x, y, font_size, col);
+        break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + PATH_ENDS_NOT_LINKABLE:
+        DrawText("Board validation : Error ! Future paths of an empty region would need the same tiles", x, y, font_size, col);
+        break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + COLOUR_IMBALANCE_NOT_FILLABLE:
+        DrawText("Board validation : Error ! Remaining pieces can't cover the empty tiles colours", x, y, font_size, col);
+        break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + TILE_TYPES_NOT_FILLABLE:
+        DrawText("Board validation : Error ! Remaining pieces don't have the tile types of the level hints", x, y, font_size, col);
+        break;
+    case POST_ADDING_CHECK_STATUS_OFFSET + SMALL_REGION_NOT_FILLABLE:
+        DrawText("Board validation : Error ! Remaining pieces can't fill the shape of a small empty region", x, y, font_size, col);
+        break;
 
     // special cases to display undo operation logs
     case UNDO_SUCCESS:
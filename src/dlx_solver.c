@@ -0,0 +1,622 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file dlx_solver.c
+ *
+ * Second solving engine, independent of the backtracking one (see search_algorithm.c), based on Knuth's "Dancing links" (algorithm C, with colors)
+ *
+ * Explanation :
+ *
+ *      A complete board is an exact cover problem : each of the 32 positions is covered by exactly 1 tile, and each piece is added exactly once.
+ *
+ *      1) The matrix (see dlx_solver.h > DlxMatrix)
+ *
+ *      - Primary items : the positions that are not filled by level hints pieces, and the pieces that are not added by level hints.
+ *      - Rows : the placements of these pieces (see placement.h) that can be added to the level hints board (see board.c > "can_placement_be_added_to_board").
+ *        It already takes care of the obligatory tiles, of the level points (only point pieces on open points can play their side with a point),
+ *        and of the connections with the level hints pieces.
+ *      - Secondary items : the edges between 2 positions that are not filled by level hints pieces.
+ *        A row colors each edge between one of its tiles and an outside position, with CONNECTED_EDGE if the tile has a connection in this direction, or NOT_CONNECTED_EDGE.
+ *        2 pieces fit together <=> they give the same color to their common edges (it is the missing connection tiles pre-adding check, see board.c).
+ *
+ *      2) The search
+ *
+ *      At each step, the primary item that has the fewest rows left is chosen (a position that only 1 piece can still fill, or a piece that only fits in 1 place),
+ *      and each of its rows is tried one after the other, the rows that conflict with it are removed from the matrix, and put back when backtracking.
+ *      The number of tried rows is the node count, the equivalent of the valid board count of the backtracking engine.
+ *
+ *      3) Loops
+ *
+ *      An exact cover with matching colors is a complete board where all paths are connected, but a path could still be a loop.
+ *      Its placements are added to the board, and if a connected tile can't be reached by following the paths from the points, there's a loop and the search goes on.
+ *      (with all positions filled, paths can only end on points)
+ */
+
+#include <time.h> // clock_gettime, struct timespec
+#include <stdbool.h>
+#include <stdint.h> // uint32_t, uint8_t
+#include <stdio.h>  // printf
+#include <stdlib.h> // malloc, free
+
+#include <raylib/raylib.h> // WindowShouldClose, CloseWindow, BeginDrawing, EndDrawing, ClearBackground
+
+#include <local/utils.h>      // Vector2_int, bitboard macros and defines
+#include <local/piece_data.h> // Tile, Piece and defines
+#include <local/level_data.h> // LevelHints, get_level_hints
+#include <local/board.h>      // Board, init_board, add_placement_to_board, undo_last_piece_adding, extract_normal_tile_at_pos, get_tile_connection_mask
+#include <local/placement.h>  // placement_table, load_placement_table
+#include <local/display.h>    // tile_px_width, and other drawing functions
+
+#include <local/dlx_solver.h>
+
+#define NO_DLX_ITEM 0
+
+/**
+ * @struct DlxSolver
+ * Data of 1 solve
+ */
+typedef struct DlxSolver
+{
+    DlxMatrix matrix;
+    Board *board; // level hints board, then the solution board
+
+    int chosen_node_array[NB_OF_PIECES]; // node of the chosen row at each depth
+    int node_count;
+    int nb_of_rejected_covers; // exact covers that had a loop
+
+} DlxSolver;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+static double get_elapsed_seconds(struct timespec *begin, struct timespec *end)
+{
+    return (double)(end->tv_sec - begin->tv_sec) + (double)(end->tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+// Returns the index of the edge between the position "bit_idx" and its neighbour in "direction", -1 if the neighbour is outside the board
+// horizontal edges (between i and i + 1) come first, then vertical edges (between j and j + 1)
+static int get_edge_idx(int bit_idx, Direction direction)
+{
+    int i = bit_idx / BOARD_HEIGHT;
+    int j = bit_idx % BOARD_HEIGHT;
+
+    switch (direction)
+    {
+    case RIGHT:
+        return (i + 1 < BOARD_WIDTH) ? POS_TO_BIT_IDX(i, j) : -1;
+    case LEFT:
+        return (i > 0) ? POS_TO_BIT_IDX(i - 1, j) : -1;
+    case DOWN:
+        return (j + 1 < BOARD_HEIGHT) ? (BOARD_WIDTH - 1) * BOARD_HEIGHT + i * (BOARD_HEIGHT - 1) + j : -1;
+    case UP:
+        return (j > 0) ? (BOARD_WIDTH - 1) * BOARD_HEIGHT + i * (BOARD_HEIGHT - 1) + j - 1 : -1;
+    default:
+        return -1;
+    }
+}
+
+// Returns the bit index of the neighbour of "bit_idx" in "direction" (which must be inside the board)
+static int get_neighbour_bit_idx(int bit_idx, Direction direction)
+{
+    switch (direction)
+    {
+    case RIGHT:
+        return bit_idx + BOARD_HEIGHT;
+    case LEFT:
+        return bit_idx - BOARD_HEIGHT;
+    case DOWN:
+        return bit_idx + 1;
+    default:
+        return bit_idx - 1;
+    }
+}
+
+// -------------- Matrix construction ---------------------------------------------------------------------------------
+
+static int append_item(DlxMatrix *matrix)
+{
+    int item = ++(matrix->nb_of_items);
+
+    // empty vertical list
+    matrix->top_array[item] = 0;
+    matrix->up_array[item] = item;
+    matrix->down_array[item] = item;
+    return item;
+}
+
+static void append_node(DlxMatrix *matrix, int item, int color)
+{
+    int node = matrix->nb_of_nodes++;
+
+    matrix->top_array[node] = item;
+    matrix->color_array[node] = color;
+
+    // at the bottom of the item vertical list
+    matrix->up_array[node] = matrix->up_array[item];
+    matrix->down_array[node] = item;
+    matrix->down_array[matrix->up_array[item]] = node;
+    matrix->up_array[item] = node;
+    matrix->top_array[item]++;
+}
+
+// Function to end the current row with a spacer node (that links the first node of the row, and the last node of the next one)
+static void append_spacer(DlxMatrix *matrix, int first_node_of_row)
+{
+    int spacer = matrix->nb_of_nodes++;
+
+    matrix->top_array[spacer] = -(matrix->nb_of_rows);
+    matrix->up_array[spacer] = first_node_of_row;
+    matrix->down_array[spacer] = spacer; // updated when the next row ends
+    matrix->color_array[spacer] = 0;
+}
+
+// Function to build the exact cover matrix of the level hints board (see this file description)
+static void build_matrix(DlxMatrix *matrix, Board *board)
+{
+    int cell_item_array[BOARD_TOTAL_NB_TILES];
+    int piece_item_array[NB_OF_PIECES];
+    int edge_item_array[NB_OF_BOARD_EDGES];
+    bool is_piece_added_array[NB_OF_PIECES] = {false};
+    const Placement *placement;
+    int bit_idx, piece_idx, placement_idx, tile_idx, edge_idx, neighbour_bit_idx, item;
+    int first_node_of_row, previous_spacer;
+    Direction direction;
+
+    matrix->nb_of_items = 0;
+    matrix->nb_of_rows = 0;
+
+    for (int i = 0; i < board->nb_of_added_pieces; i++)
+        is_piece_added_array[board->added_piece_idx_array[i]] = true;
+
+    // 1) Primary items, positions then pieces
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        cell_item_array[bit_idx] = NO_DLX_ITEM;
+        if (!(board->normal_tile_mask & (((uint32_t)1) << bit_idx)))
+            cell_item_array[bit_idx] = append_item(matrix);
+    }
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece_item_array[piece_idx] = NO_DLX_ITEM;
+        if (!is_piece_added_array[piece_idx])
+            piece_item_array[piece_idx] = append_item(matrix);
+    }
+    matrix->nb_of_primary_items = matrix->nb_of_items;
+
+    // 2) Secondary items, edges between 2 empty positions
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        for (direction = RIGHT; direction <= DOWN; direction++)
+        {
+            edge_idx = get_edge_idx(bit_idx, direction);
+            if (edge_idx < 0)
+                continue;
+
+            edge_item_array[edge_idx] = NO_DLX_ITEM;
+            if (cell_item_array[bit_idx] != NO_DLX_ITEM && cell_item_array[get_neighbour_bit_idx(bit_idx, direction)] != NO_DLX_ITEM)
+                edge_item_array[edge_idx] = append_item(matrix);
+        }
+    }
+    // item headers are the first nodes (node 0 is unused, so that node and item indexes are the same)
+    matrix->nb_of_nodes = matrix->nb_of_items + 1;
+
+    // horizontal list of the primary items only
+    for (item = 0; item <= matrix->nb_of_primary_items; item++)
+    {
+        matrix->item_left_array[item] = (item == 0) ? matrix->nb_of_primary_items : item - 1;
+        matrix->item_right_array[item] = (item == matrix->nb_of_primary_items) ? 0 : item + 1;
+    }
+
+    // 3) Rows, the placements of the remaining pieces that fit on the level hints board
+    previous_spacer = matrix->nb_of_nodes;
+    append_spacer(matrix, 0);
+
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        if (is_piece_added_array[piece_idx])
+            continue;
+
+        for (placement_idx = placement_table.first_placement_idx_array[piece_idx][0]; placement_idx < placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE]; placement_idx++)
+        {
+            if (add_placement_to_board(board, placement_idx) != 1)
+                continue;
+            undo_last_piece_adding(board);
+
+            placement = (placement_table.placement_array) + placement_idx;
+            first_node_of_row = matrix->nb_of_nodes;
+
+            append_node(matrix, piece_item_array[piece_idx], 0);
+            for (tile_idx = 0; tile_idx < board->piece_array[piece_idx].side_array[placement->side_idx].nb_of_tiles; tile_idx++)
+            {
+                bit_idx = placement->tile_bit_idx_array[tile_idx];
+                append_node(matrix, cell_item_array[bit_idx], 0);
+
+                for (direction = 0; direction < NB_OF_DIRECTIONS; direction++)
+                {
+                    edge_idx = get_edge_idx(bit_idx, direction);
+                    if (edge_idx < 0 || edge_item_array[edge_idx] == NO_DLX_ITEM)
+                        continue;
+
+                    // edges inside the piece are always fine
+                    neighbour_bit_idx = get_neighbour_bit_idx(bit_idx, direction);
+                    if (placement->tile_mask & (((uint32_t)1) << neighbour_bit_idx))
+                        continue;
+
+                    append_node(matrix, edge_item_array[edge_idx], (placement->tile_connection_mask_array[tile_idx] & DIRECTION_TO_MASK(direction)) ? CONNECTED_EDGE : NOT_CONNECTED_EDGE);
+                }
+            }
+
+            matrix->row_placement_idx_array[matrix->nb_of_rows] = placement_idx;
+            matrix->nb_of_rows++;
+
+            matrix->down_array[previous_spacer] = matrix->nb_of_nodes - 1;
+            previous_spacer = matrix->nb_of_nodes;
+            append_spacer(matrix, first_node_of_row);
+        }
+    }
+}
+
+// -------------- Dancing links operations (names from Knuth's algorithm C) ---------------------------------------------------------------------------------
+
+// Function to remove the other nodes of the row of "node" from their item lists
+static void hide(DlxMatrix *matrix, int node)
+{
+    int q = node + 1;
+    int item, up, down;
+
+    while (q != node)
+    {
+        item = matrix->top_array[q];
+        up = matrix->up_array[q];
+        down = matrix->down_array[q];
+
+        if (item <= 0)
+        {
+            q = up; // spacer, back to the first node of the row
+            continue;
+        }
+
+        if (matrix->color_array[q] >= 0)
+        {
+            matrix->down_array[up] = down;
+            matrix->up_array[down] = up;
+            matrix->top_array[item]--;
+        }
+        q++;
+    }
+}
+
+static void unhide(DlxMatrix *matrix, int node)
+{
+    int q = node - 1;
+    int item, up, down;
+
+    while (q != node)
+    {
+        item = matrix->top_array[q];
+        up = matrix->up_array[q];
+        down = matrix->down_array[q];
+
+        if (item <= 0)
+        {
+            q = down; // spacer, back to the last node of the row
+            continue;
+        }
+
+        if (matrix->color_array[q] >= 0)
+        {
+            matrix->down_array[up] = q;
+            matrix->up_array[down] = q;
+            matrix->top_array[item]++;
+        }
+        q--;
+    }
+}
+
+static void cover(DlxMatrix *matrix, int item)
+{
+    int left, right;
+
+    for (int node = matrix->down_array[item]; node != item; node = matrix->down_array[node])
+        hide(matrix, node);
+
+    left = matrix->item_left_array[item];
+    right = matrix->item_right_array[item];
+    matrix->item_right_array[left] = right;
+    matrix->item_left_array[right] = left;
+}
+
+static void uncover(DlxMatrix *matrix, int item)
+{
+    int left = matrix->item_left_array[item];
+    int right = matrix->item_right_array[item];
+
+    matrix->item_right_array[left] = item;
+    matrix->item_left_array[right] = item;
+
+    for (int node = matrix->up_array[item]; node != item; node = matrix->up_array[node])
+        unhide(matrix, node);
+}
+
+// Function to keep only the rows that give the same color as "node" to its item
+static void purify(DlxMatrix *matrix, int node)
+{
+    int color = matrix->color_array[node];
+    int item = matrix->top_array[node];
+
+    for (int q = matrix->down_array[item]; q != item; q = matrix->down_array[q])
+    {
+        if (matrix->color_array[q] == color)
+            matrix->color_array[q] = -1;
+        else
+            hide(matrix, q);
+    }
+}
+
+static void unpurify(DlxMatrix *matrix, int node)
+{
+    int color = matrix->color_array[node];
+    int item = matrix->top_array[node];
+
+    for (int q = matrix->up_array[item]; q != item; q = matrix->up_array[q])
+    {
+        if (matrix->color_array[q] < 0)
+            matrix->color_array[q] = color;
+        else
+            unhide(matrix, q);
+    }
+}
+
+static void commit(DlxMatrix *matrix, int node, int item)
+{
+    if (matrix->color_array[node] == 0)
+        cover(matrix, item);
+    else if (matrix->color_array[node] > 0)
+        purify(matrix, node);
+}
+
+static void uncommit(DlxMatrix *matrix, int node, int item)
+{
+    if (matrix->color_array[node] == 0)
+        uncover(matrix, item);
+    else if (matrix->color_array[node] > 0)
+        unpurify(matrix, node);
+}
+
+// Returns the primary item left with the fewest rows (the first one in case of a tie)
+static int choose_item(DlxMatrix *matrix)
+{
+    int best_item = matrix->item_right_array[0];
+
+    for (int item = matrix->item_right_array[best_item]; item != 0; item = matrix->item_right_array[item])
+        if (matrix->top_array[item] < matrix->top_array[best_item])
+            best_item = item;
+
+    return best_item;
+}
+
+// Returns the placement of the row of "node"
+static int get_node_placement_idx(DlxMatrix *matrix, int node)
+{
+    while (matrix->top_array[node] > 0)
+        node--;
+
+    return matrix->row_placement_idx_array[-(matrix->top_array[node])];
+}
+
+// -------------- Exact cover validation ---------------------------------------------------------------------------------
+
+// Returns true if all the connected tiles of the complete board can be reached by following the paths from the point tiles
+static bool is_every_path_ending_with_points(Board *board)
+{
+    uint8_t connection_mask_array[BOARD_TOTAL_NB_TILES];
+    int bit_idx_to_visit_array[BOARD_TOTAL_NB_TILES];
+    int nb_of_bit_idx_to_visit = 0;
+    uint32_t connected_tile_mask = 0;
+    uint32_t reached_tile_mask = 0;
+    uint32_t neighbour_bit_mask;
+    int bit_idx;
+    Vector2_int pos;
+    Tile *tile;
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        BIT_IDX_TO_POS(bit_idx, &pos);
+        tile = extract_normal_tile_at_pos(board, &pos);
+        connection_mask_array[bit_idx] = (tile == UNDEFINED_TILE) ? 0 : get_tile_connection_mask(tile);
+
+        if (connection_mask_array[bit_idx] != 0)
+            connected_tile_mask |= ((uint32_t)1) << bit_idx;
+
+        if (tile != UNDEFINED_TILE && tile->tile_type == point)
+        {
+            reached_tile_mask |= ((uint32_t)1) << bit_idx;
+            bit_idx_to_visit_array[nb_of_bit_idx_to_visit++] = bit_idx;
+        }
+    }
+
+    while (nb_of_bit_idx_to_visit > 0)
+    {
+        bit_idx = bit_idx_to_visit_array[--nb_of_bit_idx_to_visit];
+        for (Direction direction = 0; direction < NB_OF_DIRECTIONS; direction++)
+        {
+            if (!(connection_mask_array[bit_idx] & DIRECTION_TO_MASK(direction)))
+                continue;
+
+            neighbour_bit_mask = ((uint32_t)1) << get_neighbour_bit_idx(bit_idx, direction);
+            if (reached_tile_mask & neighbour_bit_mask)
+                continue;
+
+            reached_tile_mask |= neighbour_bit_mask;
+            bit_idx_to_visit_array[nb_of_bit_idx_to_visit++] = get_neighbour_bit_idx(bit_idx, direction);
+        }
+    }
+
+    return reached_tile_mask == connected_tile_mask;
+}
+
+// Function to add the exact cover of the "depth" first chosen rows to the board
+// Returns true if it is the solution (the board is then left complete), false if it has a loop (the board is then back to the level hints)
+static bool load_exact_cover(DlxSolver *solver, int depth)
+{
+    int nb_of_added_rows = 0;
+
+    while (nb_of_added_rows < depth && add_placement_to_board(solver->board, get_node_placement_idx(&(solver->matrix), solver->chosen_node_array[nb_of_added_rows])) == 1)
+        nb_of_added_rows++;
+
+    if (nb_of_added_rows == depth && is_every_path_ending_with_points(solver->board))
+        return true;
+
+    while (nb_of_added_rows-- > 0)
+        undo_last_piece_adding(solver->board);
+
+    solver->nb_of_rejected_covers++;
+    return false;
+}
+
+// -------------- Search ---------------------------------------------------------------------------------
+
+// Knuth's algorithm C, recursive version
+// Returns true if the solution has been found (the matrix is then left as is)
+static bool search(DlxSolver *solver, int depth)
+{
+    DlxMatrix *matrix = &(solver->matrix);
+    int item, node, q;
+
+    if (matrix->item_right_array[0] == 0)
+        return load_exact_cover(solver, depth);
+
+    item = choose_item(matrix);
+    if (matrix->top_array[item] == 0)
+        return false;
+
+    cover(matrix, item);
+
+    for (node = matrix->down_array[item]; node != item; node = matrix->down_array[node])
+    {
+        solver->chosen_node_array[depth] = node;
+        solver->node_count++;
+
+        // commit the other items of the row (q goes back to the start of the row on its spacer)
+        for (q = node + 1; q != node;)
+        {
+            if (matrix->top_array[q] <= 0)
+            {
+                q = matrix->up_array[q];
+                continue;
+            }
+            commit(matrix, q, matrix->top_array[q]);
+            q++;
+        }
+
+        if (search(solver, depth + 1))
+            return true;
+
+        for (q = node - 1; q != node;)
+        {
+            if (matrix->top_array[q] <= 0)
+            {
+                q = matrix->down_array[q];
+                continue;
+            }
+            uncommit(matrix, q, matrix->top_array[q]);
+            q--;
+        }
+    }
+
+    uncover(matrix, item);
+    return false;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to solve a level with the dancing links engine
+// The valid board count of the result is the node count (number of rows tried), the time includes the matrix construction
+// if "solution_board" is not NULL, the solved board is handed over to the caller (to free), NULL if there is no solution
+SolverResult solve_level_with_dlx(int level_num, Board **solution_board)
+{
+    LevelHints *level_hints = get_level_hints(level_num);
+    DlxSolver *solver = malloc(sizeof(DlxSolver));
+    SolverResult result = {0};
+    struct timespec begin, end, cpu_time;
+
+    load_placement_table();
+    solver->board = init_board(level_hints);
+    solver->node_count = 0;
+    solver->nb_of_rejected_covers = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    build_matrix(&(solver->matrix), solver->board);
+    result.solved = search(solver, 0);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+
+    result.level_num = level_num;
+    result.valid_board_count = solver->node_count;
+    result.wall_time = get_elapsed_seconds(&begin, &end);
+    result.cpu_time = (double)cpu_time.tv_sec + (double)cpu_time.tv_nsec / 1e9;
+    result.nb_of_threads = 1;
+    result.node_count_array[0] = solver->node_count;
+
+    if (solution_board != NULL)
+        *solution_board = result.solved ? solver->board : NULL;
+    if (solution_board == NULL || !result.solved)
+        free(solver->board);
+
+    free(solver);
+    free(level_hints);
+
+    return result;
+}
+
+// Dancing links counterpart of search_algorithm.c > "run_algorithm_without_display"
+void run_algorithm_with_dlx(int level_num)
+{
+    Board *board;
+    SolverResult result = solve_level_with_dlx(level_num, &board);
+
+#ifndef AUTOMATED_RUNS
+
+    if (result.solved)
+        printf("Solution found!\n");
+    else
+        printf("No solution found...\n");
+    printf("Time : %.3f seconds\n", result.wall_time);
+    printf("Number of nodes : %d\n", result.valid_board_count);
+
+    // Display only the solution board
+    if (board != NULL)
+    {
+        setup_display((BOARD_WIDTH + 2) * tile_px_width, (BOARD_HEIGHT + 2) * tile_px_width);
+        offset_px.i = 1 * tile_px_width;
+        BoardDrawing *board_drawing = init_board_drawing();
+        update_board_static_drawing(board, board_drawing);
+
+        while (!WindowShouldClose())
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            draw_board(board, board_drawing);
+            draw_level_num(level_num);
+            EndDrawing();
+        }
+
+        CloseWindow();
+        free(board_drawing);
+    }
+
+#else
+    printf("%3d : ", level_num);
+    if (result.solved)
+        printf("solved -> ");
+    else
+        printf("unsolved -> ");
+    printf("%d | %d\n", result.valid_board_count, (int)(result.wall_time * 1000));
+
+#endif
+
+    free(board);
+}
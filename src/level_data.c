@@ -1792,5 +1792,7 @@ LevelHints *get_level_hints(int level_num)
         break;
     }
 
+    level_hints->level_placements.is_loaded = false;
+
     return level_hints;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include <stdio.h>
 #include <stdlib.h> // system
+#include <string.h> // strcmp
 
 #include <raylib/raylib.h>  // general helper functions of raylib
 #include <raylib/screens.h> // custom main helper functions see a raylib game template
@@ -18,6 +19,12 @@
 #include <local/search_algorithm.h> // run_algorithm_*** functions
 #include <local/display.h>          // setup_display
 #include <local/utils.h>            // find_asset_folder_relative_path and defines
+#include <local/placement.h>        // load_placement_table
+#include <local/parallel_search.h>  // run_algorithm_in_parallel
+#include <local/batch_solver.h>     // run_batch_mode, run_engine_comparison_mode
+#include <local/dlx_solver.h>       // run_algorithm_with_dlx
+#include <local/anchor_search.h>    // run_algorithm_with_anchor_cells
+#include <local/mrv_search.h>       // run_algorithm_with_mrv
 
 static void InitStaticScreens(void);
 static void UnloadStaticScreens(void);
@@ -31,8 +38,16 @@ static void DrawTransition();
 static GameScreen currentScreen;
 static bool onTransition;
 
-int main(void)
+int main(int argc, char *argv[])
 {
+    // shared read-only data of all solvers, computed once before any of them starts
+    load_placement_table();
+
+    // headless mode, no window at all (see batch_solver.c)
+    if (argc > 1 && strcmp(argv[1], "--batch") == 0)
+        return (run_batch_mode(argc, argv) == 1) ? 0 : 1;
+    if (argc > 1 && strcmp(argv[1], "--compare-engines") == 0)
+        return (run_engine_comparison_mode(argc, argv) == 1) ? 0 : 1;
 
 #ifndef AUTOMATED_RUNS
 
@@ -139,6 +154,26 @@ int main(void)
     for (int level_num = 49; level_num <= 120; level_num++)
         run_algorithm_without_display(level_num);
 
+    printf("\n\nPart in parallel (%d threads, split depth %d)\n\n", DEFAULT_NB_OF_SOLVER_THREADS, DEFAULT_SPLIT_DEPTH);
+
+    for (int level_num = 49; level_num <= 120; level_num++)
+        run_algorithm_in_parallel(level_num, DEFAULT_NB_OF_SOLVER_THREADS, DEFAULT_SPLIT_DEPTH);
+
+    printf("\n\nPart with dancing links\n\n");
+
+    for (int level_num = 49; level_num <= 120; level_num++)
+        run_algorithm_with_dlx(level_num);
+
+    printf("\n\nPart with anchor positions\n\n");
+
+    for (int level_num = 49; level_num <= 120; level_num++)
+        run_algorithm_with_anchor_cells(level_num);
+
+    printf("\n\nPart with most constrained variable branching\n\n");
+
+    for (int level_num = 49; level_num <= 120; level_num++)
+        run_algorithm_with_mrv(level_num);
+
     printf("\n\nPart with display\n\n");
 
     for (int level_num = 49; level_num <= 120; level_num++)
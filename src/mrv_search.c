@@ -0,0 +1,345 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file mrv_search.c
+ *
+ * Other branching strategy of the backtracking algorithm (see search_algorithm.c) : the most constrained variable strategy
+ *
+ * Explanation :
+ *
+ *      The main algorithm adds the pieces in a fixed order (see search_algorithm.c > "load_combination_data"),
+ *      so a big piece can be placed early in a spot that leaves some position impossible to fill, and it is only found out many pieces deeper.
+ *
+ *      Here, at each board of the search, the algorithm knows every placement of the remaining pieces that still passes the pre-adding checks (see board.c),
+ *      the "candidates", and counts them for each empty position and for each remaining piece :
+ *          - if a count is 0, an empty position can't be covered anymore, or a piece can't be added anymore => the board has no solution
+ *          - else, the algorithm branches on the position or the piece that has the fewest candidates
+ *            (in a complete board, every position is covered and every piece is added, so trying all of its candidates is enough)
+ *
+ *      1) Live candidates
+ *
+ *      Adding a piece only takes candidates away (it covers positions, it adds missing connections to match, it uses up the special pieces of double missing connections),
+ *      so the candidates of a depth are the candidates of the previous depth that are still valid.
+ *      The pre-adding checks of a candidate only depend on the positions it covers and on the double missing connections of the board,
+ *      so they are only run again for the candidates that touch the last added piece (or all of them if the double missing connections have changed).
+ *
+ *      2) Everything else is the same as the main algorithm :
+ *          - the combinations of point pieces, and the playable sides of each piece
+ *          - the post-adding checks, and the transposition table (see transposition_table.c)
+ *
+ *      The combination skipping trick and the savestates (see savestate.c) rely on the fixed order of the pieces, so they are not used here.
+ *
+ *      It is selectable next to the order based strategy, in batch mode (see batch_solver.c, --engine mrv),
+ *      to compare their valid board counts and times on each level.
+ */
+
+#include <time.h> // clock_gettime, struct timespec
+#include <stdbool.h>
+#include <stdint.h> // uint32_t
+#include <stdio.h>  // printf
+#include <stdlib.h> // malloc, free
+
+#include <raylib/raylib.h> // WindowShouldClose, CloseWindow, BeginDrawing, EndDrawing, ClearBackground
+
+#include <local/utils.h>               // bitboard macros and defines
+#include <local/piece_data.h>          // LINE2_2, T_PIECE and defines
+#include <local/level_data.h>          // LevelHints, get_level_hints
+#include <local/board.h>               // Board, init_board, add_placement_to_board, can_placement_idx_be_added_to_board, undo_last_piece_adding
+#include <local/placement.h>           // placement_table, load_placement_table
+#include <local/check_board.h>         // run_all_checks
+#include <local/solver_context.h>      // SolverContext, init_solver_context
+#include <local/transposition_table.h> // set_transposition_table_combination, is_board_known_as_dead, record_dead_board
+#include <local/search_algorithm.h>    // StartCombinations, determine_start_combinations, load_combination_data
+#include <local/display.h>             // tile_px_width, and other drawing functions
+
+#include <local/mrv_search.h>
+
+#define NO_BRANCHING_ITEM -1
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+static double get_elapsed_seconds(struct timespec *begin, struct timespec *end)
+{
+    return (double)(end->tv_sec - begin->tv_sec) + (double)(end->tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+// Function to list the candidates of the first depth : the level placements of the playable sides of the current combination (see board.h > level placements)
+// (in the order of piece_idx_priority_array, it is the order the candidates of a position are tried in)
+static void load_first_candidates(MrvSearchState *state, Board *board)
+{
+    int piece_idx, side_idx;
+    int nb_of_candidates = 0;
+
+    for (int rank = 0; rank < state->nb_of_playable_pieces; rank++)
+    {
+        piece_idx = state->piece_idx_priority_array[rank];
+        for (side_idx = 0; side_idx < MAX_NB_OF_SIDE_PER_PIECE; side_idx++)
+        {
+            if (!state->playable_side_per_piece_idx_mask[piece_idx][side_idx])
+                continue;
+
+            for (int i = board->level_placements->first_level_placement_idx_array[piece_idx][side_idx]; i < board->level_placements->first_level_placement_idx_array[piece_idx][side_idx + 1]; i++)
+            {
+                state->candidate_placement_idx_array[0][nb_of_candidates] = board->level_placements->level_placement_idx_array[i];
+                nb_of_candidates++;
+            }
+        }
+    }
+
+    state->nb_of_candidates_array[0] = nb_of_candidates;
+}
+
+// Function to list the candidates of "depth", from the ones of the previous depth that are still valid, after "last_placement_idx" has been added to the board
+static void load_candidates(MrvSearchState *state, Board *board, int depth, int last_placement_idx)
+{
+    const Placement *last_placement = (placement_table.placement_array) + last_placement_idx;
+    const Placement *placement;
+    uint32_t changed_tile_mask = last_placement->tile_mask | last_placement->missing_connection_tile_mask;
+    bool have_double_missing_connections_changed;
+    int placement_idx;
+    int nb_of_candidates = 0;
+
+    // the last piece has used up a special piece, or made a new double missing connection tile (see board.c > "can_placement_be_added_to_board")
+    have_double_missing_connections_changed = (last_placement->piece_idx == LINE2_2) || (last_placement->piece_idx == T_PIECE) || (last_placement->missing_connection_tile_mask & board->double_missing_connection_tile_mask);
+
+    for (int candidate_idx = 0; candidate_idx < state->nb_of_candidates_array[depth - 1]; candidate_idx++)
+    {
+        placement_idx = state->candidate_placement_idx_array[depth - 1][candidate_idx];
+        placement = (placement_table.placement_array) + placement_idx;
+
+        if (state->is_piece_added_array[placement->piece_idx])
+            continue;
+        if (placement->tile_mask & board->normal_tile_mask)
+            continue;
+        if ((have_double_missing_connections_changed || ((placement->tile_mask | placement->missing_connection_tile_mask) & changed_tile_mask)) && can_placement_idx_be_added_to_board(board, placement_idx) != 1)
+            continue;
+
+        state->candidate_placement_idx_array[depth][nb_of_candidates] = placement_idx;
+        nb_of_candidates++;
+    }
+
+    state->nb_of_candidates_array[depth] = nb_of_candidates;
+}
+
+// Function to count the candidates of "depth" for each empty position and each remaining piece, and to choose which one to branch on
+// Returns false if one of them has no candidate (the board has no solution), else the choice is loaded by reference :
+// the piece in "branching_piece_idx", or the position in "branching_bit_idx" (the other one is NO_BRANCHING_ITEM)
+static bool choose_branching_item(MrvSearchState *state, Board *board, int depth, int *branching_piece_idx, int *branching_bit_idx)
+{
+    int nb_of_candidates_per_piece_array[NB_OF_PIECES] = {0};
+    int nb_of_candidates_per_position_array[BOARD_TOTAL_NB_TILES] = {0};
+    const Placement *placement;
+    uint32_t tile_mask;
+    int piece_idx, bit_idx;
+    int min_nb_of_candidates = MAX_NB_OF_PLACEMENTS + 1;
+
+    for (int candidate_idx = 0; candidate_idx < state->nb_of_candidates_array[depth]; candidate_idx++)
+    {
+        placement = (placement_table.placement_array) + state->candidate_placement_idx_array[depth][candidate_idx];
+        nb_of_candidates_per_piece_array[placement->piece_idx]++;
+        for (tile_mask = placement->tile_mask, bit_idx = 0; tile_mask != 0; tile_mask >>= 1, bit_idx++)
+            if (tile_mask & 1)
+                nb_of_candidates_per_position_array[bit_idx]++;
+    }
+
+    *branching_piece_idx = NO_BRANCHING_ITEM;
+    *branching_bit_idx = NO_BRANCHING_ITEM;
+
+    // pieces first, in the order of piece_idx_priority_array, so that they win the ties (the point pieces come first)
+    for (int rank = 0; rank < state->nb_of_playable_pieces; rank++)
+    {
+        piece_idx = state->piece_idx_priority_array[rank];
+        if (state->is_piece_added_array[piece_idx])
+            continue;
+        if (nb_of_candidates_per_piece_array[piece_idx] == 0)
+            return false;
+        if (nb_of_candidates_per_piece_array[piece_idx] < min_nb_of_candidates)
+        {
+            min_nb_of_candidates = nb_of_candidates_per_piece_array[piece_idx];
+            *branching_piece_idx = piece_idx;
+        }
+    }
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        if (board->normal_tile_mask & (((uint32_t)1) << bit_idx))
+            continue;
+        if (nb_of_candidates_per_position_array[bit_idx] == 0)
+            return false;
+        if (nb_of_candidates_per_position_array[bit_idx] < min_nb_of_candidates)
+        {
+            min_nb_of_candidates = nb_of_candidates_per_position_array[bit_idx];
+            *branching_piece_idx = NO_BRANCHING_ITEM;
+            *branching_bit_idx = bit_idx;
+        }
+    }
+
+    return true;
+}
+
+// Function to explore everything under the current board, "depth" pieces having been added since the start of the combination
+// Returns true if the level has been solved (the solution is left on the board), else the board is back to its state
+static bool explore_board(MrvSearchState *state, Board *board, SolverContext *context, int depth)
+{
+    const Placement *placement;
+    int branching_piece_idx, branching_bit_idx;
+    int placement_idx;
+
+    if (depth == state->nb_of_playable_pieces)
+        return true;
+
+    // a position that can't be covered anymore, or a piece that can't be added anymore
+    if (!choose_branching_item(state, board, depth, &branching_piece_idx, &branching_bit_idx))
+        return false;
+
+    for (int candidate_idx = 0; candidate_idx < state->nb_of_candidates_array[depth]; candidate_idx++)
+    {
+        placement_idx = state->candidate_placement_idx_array[depth][candidate_idx];
+        placement = (placement_table.placement_array) + placement_idx;
+
+        if (branching_piece_idx != NO_BRANCHING_ITEM && placement->piece_idx != branching_piece_idx)
+            continue;
+        if (branching_bit_idx != NO_BRANCHING_ITEM && !(placement->tile_mask & (((uint32_t)1) << branching_bit_idx)))
+            continue;
+
+        // Board pre-adding, adding piece, and post-adding checks (the pre-adding checks pass, it is a candidate)
+        if (add_placement_to_board(board, placement_idx) != 1)
+            continue;
+
+        if (is_board_known_as_dead(&(context->transposition_table), board->zobrist_key))
+        {
+            undo_last_piece_adding(board);
+            continue;
+        }
+
+        if (run_all_checks(board, context, false) != 1)
+        {
+            undo_last_piece_adding(board);
+            continue;
+        }
+
+        state->valid_board_count++;
+        state->is_piece_added_array[placement->piece_idx] = true;
+        load_candidates(state, board, depth + 1, placement_idx);
+
+        if (explore_board(state, board, context, depth + 1))
+            return true;
+
+        state->is_piece_added_array[placement->piece_idx] = false;
+        undo_last_piece_adding(board);
+    }
+
+    // the branching position or piece has gone through all its candidates on the current board, and it must be covered / added
+    // => the current board has no solution
+    record_dead_board(&(context->transposition_table), board->zobrist_key);
+    return false;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to solve a level with the most constrained variable strategy on the calling thread (see this file description)
+// if "solution_board" is not NULL, the solved board is handed over to the caller (to free), NULL if there is no solution
+SolverResult solve_level_with_mrv(int level_num, Board **solution_board)
+{
+    LevelHints *level_hints = get_level_hints(level_num);
+    Board *board;
+    SolverContext *context = init_solver_context();
+    MrvSearchState *state = malloc(sizeof(MrvSearchState));
+    StartCombinations start_combinations;
+    SolverResult result = {0};
+    struct timespec begin, end, cpu_time;
+
+    load_placement_table();
+    board = init_board(level_hints);
+    start_combinations = determine_start_combinations(board);
+    state->valid_board_count = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    for (int combination_idx = 0; combination_idx < start_combinations.nb_of_combinations; combination_idx++)
+    {
+        load_combination_data(board, &start_combinations, combination_idx, state->piece_idx_priority_array, &(state->nb_of_playable_pieces), state->playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), state->piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
+
+        for (int i = 0; i < NB_OF_PIECES; i++)
+            state->is_piece_added_array[i] = false;
+        load_first_candidates(state, board);
+
+        if (explore_board(state, board, context, 0))
+        {
+            result.solved = true;
+            break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+
+    result.level_num = level_num;
+    result.valid_board_count = state->valid_board_count;
+    result.wall_time = get_elapsed_seconds(&begin, &end);
+    result.cpu_time = (double)cpu_time.tv_sec + (double)cpu_time.tv_nsec / 1e9;
+    result.nb_of_threads = 1;
+    result.node_count_array[0] = state->valid_board_count;
+
+    if (solution_board != NULL)
+        *solution_board = result.solved ? board : NULL;
+    if (solution_board == NULL || !result.solved)
+        free(board);
+
+    free(state);
+    free(context);
+    free(level_hints);
+
+    return result;
+}
+
+// Most constrained variable counterpart of search_algorithm.c > "run_algorithm_without_display"
+void run_algorithm_with_mrv(int level_num)
+{
+    Board *board;
+    SolverResult result = solve_level_with_mrv(level_num, &board);
+
+#ifndef AUTOMATED_RUNS
+
+    if (result.solved)
+        printf("Solution found!\n");
+    else
+        printf("No solution found...\n");
+    printf("Time : %.3f seconds\n", result.wall_time);
+    printf("Number of valid boards : %d\n", result.valid_board_count);
+
+    // Display only the solution board
+    if (board != NULL)
+    {
+        setup_display((BOARD_WIDTH + 2) * tile_px_width, (BOARD_HEIGHT + 2) * tile_px_width);
+        offset_px.i = 1 * tile_px_width;
+        BoardDrawing *board_drawing = init_board_drawing();
+        update_board_static_drawing(board, board_drawing);
+
+        while (!WindowShouldClose())
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            draw_board(board, board_drawing);
+            draw_level_num(level_num);
+            EndDrawing();
+        }
+
+        CloseWindow();
+        free(board_drawing);
+    }
+
+#else
+    printf("%3d : ", level_num);
+    if (result.solved)
+        printf("solved -> ");
+    else
+        printf("unsolved -> ");
+    printf("%d | %d\n", result.valid_board_count, (int)(result.wall_time * 1000));
+
+#endif
+
+    free(board);
+}
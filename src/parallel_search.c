@@ -0,0 +1,698 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file parallel_search.c
+ *
+ * Same search algorithm as search_algorithm.c > "run_algorithm_without_display", but explored by several threads at the same time
+ *
+ * Explanation :
+ *
+ *      1) Parallel combinations
+ *
+ *      The trees of the different combinations are independent of each other (see search_algorithm.c description),
+ *      so each thread takes the next unexplored combination, explores its whole tree, and takes the next one, until there are no more combinations.
+ *      Levels with 4 open points have up to 70 combinations, that is where it shines.
+ *
+ *      - Each thread has its own board and its own solver context (see solver_context.h), the only shared data are read-only (level hints, placement table),
+ *        or behind the atomic variables / the mutexes.
+ *        (a board can't simply be memcpy-ed as its tile stacks point to its own pieces, so each thread initializes its own from the level hints)
+ *
+ *      - As soon as a thread finds the solution, the other ones stop where they are.
+ *
+ *      - The combination skipping trick (see search_algorithm.c > "is_current_combination_skippable") still works across threads :
+ *        each failed combination is recorded, and a combination is skipped if it starts with the failure pieces of any recorded one.
+ *        The combinations are handed out in the same order as the sequential algorithm, but a combination can start before the previous ones are done,
+ *        so a bit less of them get skipped.
+ *
+ *      - Each thread resumes its new combination from the savestates of its own previous one (see savestate.c),
+ *        only when combinations are not split between threads (split_depth = 0), as a thread must have explored a whole combination to have all its savestates.
+ *
+ *      2) Work stealing inside a combination
+ *
+ *      Wizard levels with 2 open points have very few combinations, and almost all the work is in 1 of them.
+ *      So when there are no more combinations to hand out, idle threads steal work from busy ones :
+ *
+ *      - At each depth lower than "split_depth" (depth = index in piece_idx_priority_array), a busy thread publishes
+ *        the placement of its piece, and the end of the placement range it still has to try (see placement.h, placements of a piece are contiguous).
+ *
+ *      - A thief looks for the shallowest depth where a busy thread has untried placements left, and takes the upper half of them.
+ *        It replays the placements of the shallower depths on its own board (they were valid on the other board, they are valid on its board),
+ *        then explores its half, and everything under it, like any other subtree.
+ *        (the range can also be split again by another thief)
+ *
+ *      - The thread that got robbed only sees a lower end of range, and it may have already found a placement beyond the new end while the split happened :
+ *        that's why a placement at a published depth is always confirmed under the lock before being explored.
+ *
+ *      - A combination has failed when all the subtrees it has been split into are done, its max depth is the max of all of them.
+ *
+ *      Deeper split depths give more work to steal, but more locking for the busy threads and smaller subtrees (that end quickly) for the thieves.
+ *      The node count (valid boards) and the steal count of each thread are reported to tune it.
+ *
+ *      The valid board count is the sum of every thread count, it depends on how threads share the work,
+ *      so it changes from one run to another and is not comparable with the sequential algorithm one.
+ */
+
+#include <time.h> // clock_gettime, struct timespec
+#include <stdbool.h>
+#include <stdio.h>     // printf
+#include <stdlib.h>    // free
+#include <sched.h>     // sched_yield
+#include <pthread.h>   // pthread_t, pthread_create, pthread_join, pthread_mutex_t and functions
+#include <stdatomic.h> // atomic_int, atomic_bool and functions
+
+#include <raylib/raylib.h> // WindowShouldClose, CloseWindow, BeginDrawing, EndDrawing, ClearBackground
+
+#include <local/utils.h>            // defines
+#include <local/piece_data.h>       // Piece and defines
+#include <local/level_data.h>       // LevelHints, get_level_hints
+#include <local/board.h>            // Board, init_board, add_placement_to_board, undo_last_piece_adding
+#include <local/placement.h>        // placement_table, load_placement_table, UNDEFINED_PLACEMENT_IDX
+#include <local/solver_context.h>   // SolverContext, CheckSettings, init_solver_context, get_default_check_settings
+#include <local/savestate.h>        // start_combination_from_savestates, record_savestate, load_next_savestate
+#include <local/search_algorithm.h> // StartCombinations, and helper functions of the main algorithm
+#include <local/display.h>          // tile_px_width, and other drawing functions
+
+#include <local/parallel_search.h>
+
+#define NO_SOLVER_THREAD -1
+#define NO_COMBINATION -1
+
+/**
+ * @struct SharedSolveData
+ * Data shared by all the threads of 1 solve
+ */
+typedef struct SharedSolveData
+{
+    StartCombinations start_combinations; // read-only once threads are started
+    int split_depth;                      // read-only once threads are started
+    CheckSettings check_settings;         // read-only once threads are started
+
+    atomic_int next_combination_idx; // next combination to hand out
+    atomic_int nb_of_busy_threads;   // threads that have a subtree to explore (a thief is counted as busy as soon as it has stolen something)
+    atomic_bool is_solved;           // stop signal of all the threads
+
+    // ------ Protected by mutex
+    pthread_mutex_t mutex;
+    int nb_of_running_subtrees_array[MAX_NB_OF_COMBINATIONS]; // number of threads currently exploring a part of each combination
+    int max_depth_array[MAX_NB_OF_COMBINATIONS];              // max of current_max_depth of all the explored parts of each combination
+    bool has_been_cut_array[MAX_NB_OF_COMBINATIONS];          // true if a transposition table has discarded boards in any part of each combination
+    int failed_piece_priority_array[MAX_NB_OF_COMBINATIONS][NB_OF_PIECES]; // see search_algorithm.c > "is_current_combination_skippable"
+    int failed_max_depth_array[MAX_NB_OF_COMBINATIONS];
+    int nb_of_failed_combinations;
+    int solver_thread_idx; // thread whose board is the solution (NO_SOLVER_THREAD while not solved)
+
+} SharedSolveData;
+
+/**
+ * @struct SolverThread
+ * Data owned by 1 thread of a solve
+ */
+typedef struct SolverThread
+{
+    SharedSolveData *shared;
+    int thread_idx;
+    pthread_t thread;
+
+    Board *board;
+    SolverContext *context;
+
+    // ------ Current combination data (see search_algorithm.c > "load_combination_data")
+    int piece_idx_priority_array[NB_OF_PIECES];
+    int nb_of_playable_pieces;
+    bool playable_side_per_piece_idx_mask[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE];
+
+    // ------ Published search state, protected by mutex (read by thieves)
+    // at each published depth, the placements still to try are in ]published_placement_idx_array[depth], last_placement_idx_array[depth][
+    pthread_mutex_t mutex;
+    int combination_idx;
+    int nb_of_published_depths;
+    int published_placement_idx_array[NB_OF_PIECES]; // placement of the piece at this depth (or the one before the first to try)
+    int last_placement_idx_array[NB_OF_PIECES];
+
+    // ------ Thread stats
+    int valid_board_count;
+    int steal_count;
+    double cpu_time;
+
+} SolverThread;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+static double get_elapsed_seconds(struct timespec *begin, struct timespec *end)
+{
+    return (double)(end->tv_sec - begin->tv_sec) + (double)(end->tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+static int get_first_placement_idx(int piece_idx)
+{
+    return placement_table.first_placement_idx_array[piece_idx][0];
+}
+
+static int get_last_placement_idx(int piece_idx)
+{
+    return placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE];
+}
+
+// -------------- Combination bookkeeping (shared mutex) ---------------------------------------------------------------------------------
+
+// Function to start the exploration of a new combination by the thread
+// Returns false if the combination can be skipped (it starts with the same failure pieces as an already failed one)
+static bool start_combination(SolverThread *solver_thread, int combination_idx)
+{
+    SharedSolveData *shared = solver_thread->shared;
+    bool is_skippable = false;
+
+    load_combination_data(solver_thread->board, &(shared->start_combinations), combination_idx, solver_thread->piece_idx_priority_array, &(solver_thread->nb_of_playable_pieces), solver_thread->playable_side_per_piece_idx_mask);
+    set_transposition_table_combination(&(solver_thread->context->transposition_table), solver_thread->piece_idx_priority_array, solver_thread->board->nb_of_open_obligatory_point_tiles);
+
+    pthread_mutex_lock(&(shared->mutex));
+    for (int i = 0; i < shared->nb_of_failed_combinations; i++)
+    {
+        if (is_current_combination_skippable(shared->failed_max_depth_array[i], solver_thread->piece_idx_priority_array, shared->failed_piece_priority_array[i]))
+        {
+            is_skippable = true;
+            break;
+        }
+    }
+    if (!is_skippable)
+    {
+        shared->nb_of_running_subtrees_array[combination_idx] = 1;
+        shared->max_depth_array[combination_idx] = 0;
+        shared->has_been_cut_array[combination_idx] = false;
+    }
+    pthread_mutex_unlock(&(shared->mutex));
+
+    return !is_skippable;
+}
+
+// Function to call when the thread has explored all of its subtree of a combination, without finding the solution
+// the last thread to finish a part of the combination records it as failed
+static void end_subtree(SolverThread *solver_thread, int combination_idx, int current_max_depth)
+{
+    SharedSolveData *shared = solver_thread->shared;
+
+    pthread_mutex_lock(&(shared->mutex));
+
+    if (current_max_depth > shared->max_depth_array[combination_idx])
+        shared->max_depth_array[combination_idx] = current_max_depth;
+    if (has_transposition_table_cut_current_combination(&(solver_thread->context->transposition_table)))
+        shared->has_been_cut_array[combination_idx] = true;
+    shared->nb_of_running_subtrees_array[combination_idx]--;
+
+    // (see search_algorithm.c > "record_combination_failure", the failure point of a combination cut by a transposition table is unknown)
+    if (shared->nb_of_running_subtrees_array[combination_idx] == 0 && !shared->has_been_cut_array[combination_idx])
+    {
+        // copy the current piece_priority_array up to the failure point
+        current_max_depth = shared->max_depth_array[combination_idx];
+        for (int i = 0; i < current_max_depth + 1; i++)
+            shared->failed_piece_priority_array[shared->nb_of_failed_combinations][i] = solver_thread->piece_idx_priority_array[i];
+        shared->failed_max_depth_array[shared->nb_of_failed_combinations] = current_max_depth;
+        shared->nb_of_failed_combinations++;
+    }
+
+    pthread_mutex_unlock(&(shared->mutex));
+}
+
+// Only the first thread to find a solution is recorded (2 threads could find one at the same time on 2 different subtrees)
+static void record_solution(SolverThread *solver_thread)
+{
+    SharedSolveData *shared = solver_thread->shared;
+
+    pthread_mutex_lock(&(shared->mutex));
+    if (shared->solver_thread_idx == NO_SOLVER_THREAD)
+        shared->solver_thread_idx = solver_thread->thread_idx;
+    pthread_mutex_unlock(&(shared->mutex));
+
+    atomic_store(&(shared->is_solved), true);
+}
+
+// -------------- Published search state (thread mutex) ---------------------------------------------------------------------------------
+
+// Function to publish that "depth" is the new deepest depth of the thread, with all the placements of its piece to try
+// (mutex must be locked)
+static void publish_new_depth(SolverThread *solver_thread, int depth)
+{
+    int piece_idx;
+
+    if (depth >= solver_thread->shared->split_depth || depth >= solver_thread->nb_of_playable_pieces)
+    {
+        solver_thread->nb_of_published_depths = depth;
+        return;
+    }
+
+    piece_idx = solver_thread->piece_idx_priority_array[depth];
+    solver_thread->published_placement_idx_array[depth] = get_first_placement_idx(piece_idx) - 1;
+    solver_thread->last_placement_idx_array[depth] = get_last_placement_idx(piece_idx);
+    solver_thread->nb_of_published_depths = depth + 1;
+}
+
+// Function to add the piece at "depth" to the board at its next valid placement, starting from "first_placement_idx"
+// (or from the placement after its current one if "is_backtrack_iteration")
+// At published depths, the end of range can be lowered by thieves at any time, so the found placement is confirmed under the lock
+// Returns true if the piece has been added (the next depth is then published)
+static bool add_piece_at_depth(SolverThread *solver_thread, int depth, int first_placement_idx, bool is_backtrack_iteration)
+{
+    Board *board = solver_thread->board;
+    int piece_idx = solver_thread->piece_idx_priority_array[depth];
+    bool *playable_side_mask = solver_thread->playable_side_per_piece_idx_mask[piece_idx];
+    int last_placement_idx;
+    bool is_added;
+
+    // the thread owns the whole placement range of deeper pieces, it can record dead boards in its transposition table
+    if (depth >= solver_thread->shared->split_depth)
+        return add_piece_to_next_valid_placement(board, solver_thread->context, piece_idx, playable_side_mask, is_backtrack_iteration, false);
+
+    if (is_backtrack_iteration)
+        first_placement_idx = board->piece_array[piece_idx].current_placement_idx + 1;
+
+    pthread_mutex_lock(&(solver_thread->mutex));
+    last_placement_idx = solver_thread->last_placement_idx_array[depth];
+    pthread_mutex_unlock(&(solver_thread->mutex));
+
+    is_added = add_piece_to_valid_placement_in_range(board, solver_thread->context, piece_idx, playable_side_mask, first_placement_idx, last_placement_idx, false);
+
+    pthread_mutex_lock(&(solver_thread->mutex));
+    if (is_added && board->piece_array[piece_idx].current_placement_idx >= solver_thread->last_placement_idx_array[depth])
+    {
+        // the placement has been stolen while we were looking for it
+        undo_last_piece_adding(board);
+        board->piece_array[piece_idx].current_placement_idx = UNDEFINED_PLACEMENT_IDX;
+        is_added = false;
+    }
+    if (is_added)
+    {
+        solver_thread->published_placement_idx_array[depth] = board->piece_array[piece_idx].current_placement_idx;
+        publish_new_depth(solver_thread, depth + 1);
+    }
+    else
+        solver_thread->nb_of_published_depths = depth;
+    pthread_mutex_unlock(&(solver_thread->mutex));
+
+    return is_added;
+}
+
+// -------------- Exploration ---------------------------------------------------------------------------------
+
+// Function to explore the subtree of the thread, rooted at "root_depth" (the pieces of shallower depths are already on the board)
+// same loop as search_algorithm.c > "run_algorithm_without_display"
+// (a whole combination can be explored from the savestates of the thread previous combinations, up to "similarity_depth", see savestate.c)
+// Returns true if the board is solved
+// Returns false if the subtree has no solution (the board is back to its state before the call), or if another thread has found the solution first (the board is then left as is)
+static bool explore_subtree(SolverThread *solver_thread, int root_depth, int first_root_placement_idx, int similarity_depth)
+{
+    SharedSolveData *shared = solver_thread->shared;
+    Board *board = solver_thread->board;
+
+    int piece_selected = root_depth;
+    int first_placement_idx = first_root_placement_idx;
+    int current_max_depth = 0;
+    bool backtrack_iteration = false;
+
+    while (piece_selected >= root_depth)
+    {
+        if (piece_selected < similarity_depth)
+        {
+            if (!load_next_savestate(&(solver_thread->context->savestates), board))
+                break;
+
+            piece_selected = similarity_depth;
+            backtrack_iteration = false;
+            if (board->nb_of_added_pieces > current_max_depth)
+                current_max_depth = board->nb_of_added_pieces;
+            continue;
+        }
+
+        if (piece_selected == solver_thread->nb_of_playable_pieces)
+            return true;
+
+        // relaxed is enough, it is only a stop signal, and the thread doesn't read anything written by the solving thread
+        if (atomic_load_explicit(&(shared->is_solved), memory_order_relaxed))
+            return false;
+
+        // if we are currently backtracking, the piece needs to be removed before being re-added at its next placement
+        if (backtrack_iteration)
+            undo_last_piece_adding(board);
+
+        if (add_piece_at_depth(solver_thread, piece_selected, first_placement_idx, backtrack_iteration))
+        {
+            record_savestate(&(solver_thread->context->savestates), piece_selected, board->piece_array[solver_thread->piece_idx_priority_array[piece_selected]].current_placement_idx);
+            piece_selected++;
+            solver_thread->valid_board_count++;
+            backtrack_iteration = false;
+            first_placement_idx = UNDEFINED_PLACEMENT_IDX;
+
+            if (board->nb_of_added_pieces > current_max_depth)
+                current_max_depth = board->nb_of_added_pieces;
+
+            continue;
+        }
+
+        piece_selected--;
+        backtrack_iteration = true;
+    }
+
+    end_subtree(solver_thread, solver_thread->combination_idx, current_max_depth);
+    return false;
+}
+
+// Function to explore a whole new combination
+static bool explore_combination(SolverThread *solver_thread, int combination_idx)
+{
+    int similarity_depth = 0;
+
+    if (!start_combination(solver_thread, combination_idx))
+        return false;
+
+    // savestates only hold whole combinations, they are not used when combinations can be split between threads
+    // (the thread doesn't see the boards explored by the thieves)
+    if (solver_thread->shared->split_depth == 0)
+        similarity_depth = start_combination_from_savestates(&(solver_thread->context->savestates), solver_thread->piece_idx_priority_array, solver_thread->board->nb_of_open_obligatory_point_tiles);
+
+    pthread_mutex_lock(&(solver_thread->mutex));
+    solver_thread->combination_idx = combination_idx;
+    publish_new_depth(solver_thread, 0);
+    pthread_mutex_unlock(&(solver_thread->mutex));
+
+    return explore_subtree(solver_thread, 0, UNDEFINED_PLACEMENT_IDX, similarity_depth);
+}
+
+// Function to steal the upper half of the untried placements of "victim" at its shallowest possible depth
+// Returns the depth of the stolen subtree root, the thief data are loaded with the victim path to it (-1 if there was nothing to steal)
+// (the thief is counted as busy before the victim can end its subtree, so that the busy count never drops to 0 while there is work left)
+static int steal_from(SolverThread *thief, SolverThread *victim, int *first_root_placement_idx)
+{
+    SharedSolveData *shared = thief->shared;
+    int depth, nb_of_untried_placements, first_stolen_placement_idx;
+    int stolen_depth = -1;
+
+    pthread_mutex_lock(&(victim->mutex));
+
+    for (depth = 0; depth < victim->nb_of_published_depths; depth++)
+    {
+        nb_of_untried_placements = victim->last_placement_idx_array[depth] - victim->published_placement_idx_array[depth] - 1;
+        if (nb_of_untried_placements < 2)
+            continue;
+
+        first_stolen_placement_idx = victim->published_placement_idx_array[depth] + 1 + nb_of_untried_placements / 2;
+
+        // copy the victim path, the shallower depths have nothing left to try for the thief
+        thief->combination_idx = victim->combination_idx;
+        for (int i = 0; i < depth; i++)
+        {
+            thief->published_placement_idx_array[i] = victim->published_placement_idx_array[i];
+            thief->last_placement_idx_array[i] = victim->published_placement_idx_array[i] + 1;
+        }
+        thief->published_placement_idx_array[depth] = first_stolen_placement_idx - 1;
+        thief->last_placement_idx_array[depth] = victim->last_placement_idx_array[depth];
+        victim->last_placement_idx_array[depth] = first_stolen_placement_idx;
+
+        atomic_fetch_add(&(shared->nb_of_busy_threads), 1);
+        pthread_mutex_lock(&(shared->mutex));
+        shared->nb_of_running_subtrees_array[thief->combination_idx]++;
+        pthread_mutex_unlock(&(shared->mutex));
+
+        *first_root_placement_idx = first_stolen_placement_idx;
+        stolen_depth = depth;
+        break;
+    }
+
+    pthread_mutex_unlock(&(victim->mutex));
+
+    return stolen_depth;
+}
+
+// Function to steal a subtree from any other thread, and explore it
+// Returns true if the board is solved
+static bool steal_and_explore(SolverThread *solver_thread, SolverThread *solver_thread_array, int nb_of_threads, bool *has_stolen)
+{
+    SolverThread *victim;
+    Board *board = solver_thread->board;
+    int root_depth = -1;
+    int first_root_placement_idx;
+    int depth;
+
+    *has_stolen = false;
+
+    for (int i = 1; i < nb_of_threads && root_depth < 0; i++)
+    {
+        victim = solver_thread_array + (solver_thread->thread_idx + i) % nb_of_threads;
+        root_depth = steal_from(solver_thread, victim, &first_root_placement_idx);
+    }
+
+    if (root_depth < 0)
+        return false;
+
+    *has_stolen = true;
+    solver_thread->steal_count++;
+
+    // rebuild the victim path on the thread board
+    load_combination_data(board, &(solver_thread->shared->start_combinations), solver_thread->combination_idx, solver_thread->piece_idx_priority_array, &(solver_thread->nb_of_playable_pieces), solver_thread->playable_side_per_piece_idx_mask);
+    set_transposition_table_combination(&(solver_thread->context->transposition_table), solver_thread->piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
+    for (depth = 0; depth < root_depth; depth++)
+        add_placement_to_board(board, solver_thread->published_placement_idx_array[depth]);
+
+    pthread_mutex_lock(&(solver_thread->mutex));
+    solver_thread->nb_of_published_depths = root_depth + 1;
+    pthread_mutex_unlock(&(solver_thread->mutex));
+
+    if (explore_subtree(solver_thread, root_depth, first_root_placement_idx, 0))
+        return true;
+
+    // nothing left to steal from this thread, until its next subtree
+    pthread_mutex_lock(&(solver_thread->mutex));
+    solver_thread->nb_of_published_depths = 0;
+    pthread_mutex_unlock(&(solver_thread->mutex));
+
+    // put the board back in its level hints state
+    for (depth = root_depth - 1; depth >= 0; depth--)
+    {
+        undo_last_piece_adding(board);
+        board->piece_array[solver_thread->piece_idx_priority_array[depth]].current_placement_idx = UNDEFINED_PLACEMENT_IDX;
+    }
+
+    return false;
+}
+
+// -------------- Threads ---------------------------------------------------------------------------------
+
+typedef struct SolverThreadArgs
+{
+    SolverThread *solver_thread_array;
+    int nb_of_threads;
+    int thread_idx;
+} SolverThreadArgs;
+
+static void *solver_thread_main(void *arg)
+{
+    SolverThreadArgs *args = arg;
+    SolverThread *solver_thread = (args->solver_thread_array) + args->thread_idx;
+    SharedSolveData *shared = solver_thread->shared;
+    int combination_idx;
+    bool has_stolen;
+    struct timespec cpu_time;
+
+    // 1) explore new combinations while there are some
+    atomic_fetch_add(&(shared->nb_of_busy_threads), 1);
+    while (!atomic_load(&(shared->is_solved)))
+    {
+        combination_idx = atomic_fetch_add(&(shared->next_combination_idx), 1);
+        if (combination_idx >= shared->start_combinations.nb_of_combinations)
+            break;
+
+        if (explore_combination(solver_thread, combination_idx))
+        {
+            record_solution(solver_thread);
+            break;
+        }
+    }
+    atomic_fetch_sub(&(shared->nb_of_busy_threads), 1);
+
+    // 2) then help the busy threads, until nobody has work left
+    while (shared->split_depth > 0 && !atomic_load(&(shared->is_solved)))
+    {
+        if (steal_and_explore(solver_thread, args->solver_thread_array, args->nb_of_threads, &has_stolen))
+        {
+            record_solution(solver_thread);
+            break;
+        }
+
+        if (has_stolen)
+        {
+            atomic_fetch_sub(&(shared->nb_of_busy_threads), 1);
+            continue;
+        }
+
+        if (atomic_load(&(shared->nb_of_busy_threads)) == 0)
+            break;
+
+        sched_yield();
+    }
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+    solver_thread->cpu_time = (double)cpu_time.tv_sec + (double)cpu_time.tv_nsec / 1e9;
+
+    return NULL;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to solve a level with "nb_of_threads" threads, that split combinations up to "split_depth" (0 to only explore combinations in parallel)
+// the threads run the checks with "check_settings" (see solver_context.h, get_default_check_settings unless they are benchmarked)
+// if "solution_board" is not NULL, the solved board is handed over to the caller (to free), NULL if there is no solution
+SolverResult solve_level_in_parallel(int level_num, int nb_of_threads, int split_depth, CheckSettings check_settings, Board **solution_board)
+{
+    LevelHints *level_hints = get_level_hints(level_num);
+    SharedSolveData shared;
+    SolverThread solver_thread_array[MAX_NB_OF_SOLVER_THREADS];
+    SolverThreadArgs args_array[MAX_NB_OF_SOLVER_THREADS];
+    SolverThread *solver_thread;
+    SolverResult result = {0};
+    struct timespec begin, end;
+    int thread_idx;
+
+    // shared read-only data, must be computed before threads start
+    load_placement_table();
+
+    // the first board is needed to know the combinations
+    solver_thread_array[0].board = init_board(level_hints);
+    shared.start_combinations = determine_start_combinations(solver_thread_array[0].board);
+    shared.split_depth = (split_depth > 0) ? split_depth : 0;
+    shared.check_settings = check_settings;
+
+    // without splitting, threads can't have more work than combinations
+    if (shared.split_depth == 0 && nb_of_threads > shared.start_combinations.nb_of_combinations)
+        nb_of_threads = shared.start_combinations.nb_of_combinations;
+    if (nb_of_threads > MAX_NB_OF_SOLVER_THREADS)
+        nb_of_threads = MAX_NB_OF_SOLVER_THREADS;
+    if (nb_of_threads < 1)
+        nb_of_threads = 1;
+
+    atomic_init(&(shared.next_combination_idx), 0);
+    atomic_init(&(shared.nb_of_busy_threads), 0);
+    atomic_init(&(shared.is_solved), false);
+    pthread_mutex_init(&(shared.mutex), NULL);
+    shared.nb_of_failed_combinations = 0;
+    shared.solver_thread_idx = NO_SOLVER_THREAD;
+
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+    {
+        solver_thread = solver_thread_array + thread_idx;
+        solver_thread->shared = &shared;
+        solver_thread->thread_idx = thread_idx;
+        if (thread_idx != 0)
+            solver_thread->board = init_board(level_hints);
+        solver_thread->context = init_solver_context();
+        solver_thread->context->check_settings = shared.check_settings;
+
+        pthread_mutex_init(&(solver_thread->mutex), NULL);
+        solver_thread->combination_idx = NO_COMBINATION;
+        solver_thread->nb_of_published_depths = 0;
+
+        solver_thread->valid_board_count = 0;
+        solver_thread->steal_count = 0;
+        solver_thread->cpu_time = 0;
+
+        args_array[thread_idx].solver_thread_array = solver_thread_array;
+        args_array[thread_idx].nb_of_threads = nb_of_threads;
+        args_array[thread_idx].thread_idx = thread_idx;
+    }
+
+    // timing the algorithm (threads only part)
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+        pthread_create(&(solver_thread_array[thread_idx].thread), NULL, solver_thread_main, args_array + thread_idx);
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+        pthread_join(solver_thread_array[thread_idx].thread, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    result.level_num = level_num;
+    result.solved = (shared.solver_thread_idx != NO_SOLVER_THREAD);
+    result.wall_time = get_elapsed_seconds(&begin, &end);
+    result.nb_of_threads = nb_of_threads;
+
+    if (solution_board != NULL)
+        *solution_board = NULL;
+
+    for (thread_idx = 0; thread_idx < nb_of_threads; thread_idx++)
+    {
+        solver_thread = solver_thread_array + thread_idx;
+        result.valid_board_count += solver_thread->valid_board_count;
+        result.cpu_time += solver_thread->cpu_time;
+        result.node_count_array[thread_idx] = solver_thread->valid_board_count;
+        result.steal_count_array[thread_idx] = solver_thread->steal_count;
+        for (int depth = 0; depth <= NB_OF_PIECES; depth++)
+        {
+            result.disjoint_paths_check_nb_of_calls_array[depth] += solver_thread->context->disjoint_paths_check_nb_of_calls_array[depth];
+            result.disjoint_paths_check_nb_of_cuts_array[depth] += solver_thread->context->disjoint_paths_check_nb_of_cuts_array[depth];
+        }
+
+        pthread_mutex_destroy(&(solver_thread->mutex));
+        free(solver_thread->context);
+        if (solution_board != NULL && thread_idx == shared.solver_thread_idx)
+            *solution_board = solver_thread->board;
+        else
+            free(solver_thread->board);
+    }
+
+    pthread_mutex_destroy(&(shared.mutex));
+    free(level_hints);
+
+    return result;
+}
+
+// Parallel counterpart of search_algorithm.c > "run_algorithm_without_display"
+void run_algorithm_in_parallel(int level_num, int nb_of_threads, int split_depth)
+{
+    Board *board;
+    SolverResult result = solve_level_in_parallel(level_num, nb_of_threads, split_depth, get_default_check_settings(), &board);
+
+#ifndef AUTOMATED_RUNS
+
+    if (result.solved)
+        printf("Solution found!\n");
+    else
+        printf("No solution found...\n");
+    printf("Time : %.3f seconds (CPU time : %.3f seconds)\n", result.wall_time, result.cpu_time);
+    printf("Number of valid boards : %d\n", result.valid_board_count);
+    for (int thread_idx = 0; thread_idx < result.nb_of_threads; thread_idx++)
+        printf("    thread %2d : %d valid boards, %d steals\n", thread_idx, result.node_count_array[thread_idx], result.steal_count_array[thread_idx]);
+
+    // Display only the solution board
+    if (board != NULL)
+    {
+        setup_display((BOARD_WIDTH + 2) * tile_px_width, (BOARD_HEIGHT + 2) * tile_px_width);
+        offset_px.i = 1 * tile_px_width;
+        BoardDrawing *board_drawing = init_board_drawing();
+        update_board_static_drawing(board, board_drawing);
+
+        while (!WindowShouldClose())
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            draw_board(board, board_drawing);
+            draw_level_num(level_num);
+            EndDrawing();
+        }
+
+        CloseWindow();
+        free(board_drawing);
+    }
+
+#else
+    printf("%3d : ", level_num);
+    if (result.solved)
+        printf("solved -> ");
+    else
+        printf("unsolved -> ");
+    printf("%d | %d |", result.valid_board_count, (int)(result.wall_time * 1000));
+    for (int thread_idx = 0; thread_idx < result.nb_of_threads; thread_idx++)
+        printf(" %d/%d", result.node_count_array[thread_idx], result.steal_count_array[thread_idx]);
+    printf("\n");
+
+#endif
+
+    free(board);
+}
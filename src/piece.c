@@ -22,10 +22,10 @@
 // In this latter function, we try to blit the same piece data, but check a few things to say whether or not the piece can even fit in the board
 void blit_piece_main_data(Piece *piece, int side_idx, Vector2_int base_pos, int rotation_state)
 {
-    static Side *side = NULL;
-    static Tile *current_tile = NULL;
-    static int i = 0;
-    static int connection_idx = 0;
+    Side *side = NULL;
+    Tile *current_tile = NULL;
+    int i = 0;
+    int connection_idx = 0;
 
     side = (piece->side_array) + side_idx;
 
@@ -53,26 +53,3 @@ void blit_piece_main_data(Piece *piece, int side_idx, Vector2_int base_pos, int
     piece->current_base_pos.j = base_pos.j;
     piece->current_rotation_state = rotation_state;
 }
-
-// Function to blit only border tiles of piece at the right position in the board
-// (only called by check_board.c > "check_isolated_tiles_around_piece")
-void update_piece_border_tiles(Piece *piece)
-{
-    static Side *side = NULL;
-    static Vector2_int temp_pos;
-    static int i = 0;
-
-    side = (piece->side_array) + (piece->current_side_idx);
-
-    for (i = 0; i < piece->nb_of_border_tiles; i++)
-    {
-        temp_pos = side->border_tile_relative_pos_array[i];
-        rotate_pos(&temp_pos, piece->current_rotation_state);
-        translate_pos(&temp_pos, &(piece->current_base_pos));
-
-        if (is_pos_inside_board(&temp_pos))
-            piece->border_tile_absolute_pos_array[i] = temp_pos;
-        else
-            set_invalid_pos(&(piece->border_tile_absolute_pos_array[i]));
-    }
-}
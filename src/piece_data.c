@@ -7,12 +7,15 @@
  * And there are a limited number of elementary tiles composing each side : point, line, bend, empty, (and missing_connection)
  * (missing_connection is a special type of tile related to the future main algorithm, it's like an "expected neighbour tile" type of thing)
  *
- * Other constant data is defined, which are used in the main solver algorithm like (border tiles of sides -> see check_board.c > check_isolated_tiles_around_piece function)
+ * Other constant data is defined, which are used in the main solver algorithm like (border tiles of sides -> see placement.c > compute_placement function)
  * @see piece_data.h
  *
  */
 
 #include <stdbool.h>
+#include <stdint.h> // uint32_t
+
+#include <local/utils.h> // Vector2_int, Direction, increment_pos_in_direction, reverse_direction, are_pos_equal
 
 #include <local/piece_data.h>
 
@@ -24,16 +27,132 @@
 // In my Python prototype of this project, every side just have their normal tiles
 // And there were algorithms to dynamically figure out the rest of the data, as I needed them for board checking
 // I could have made algorithms that run just once and figure init data before the main loop, but manual it is
+// (except for the path partners of missing connection tiles, see "load_path_partners", as they are easy to get wrong by hand)
+
+// -------------- Helper functions of "load_piece_array" ---------------------------------------------------------
+
+// Returns the tile of the side at a relative position, NULL if there is none
+static Tile *get_side_tile_at_relative_pos(Side *side, Vector2_int *relative_pos)
+{
+    for (int tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+        if (are_pos_equal(&(side->tile_array[tile_idx].relative_pos), relative_pos))
+            return (side->tile_array) + tile_idx;
+
+    return NULL;
+}
+
+// Function to find the other end of the path, from a missing connection tile of the side
+// The path is followed inside the side (like check_board.c > "follow_path" does on a board), until it leaves the side (on the other missing connection tile) or ends on a point tile
+// Returns the index of the other missing connection tile, or NO_PATH_END
+static int get_path_partner_idx(Side *side, int missing_connection_tile_idx)
+{
+    Tile *missing_connection_tile = (side->missing_connection_tile_array) + missing_connection_tile_idx;
+    Vector2_int current_pos = missing_connection_tile->relative_pos;
+    Direction next_direction = missing_connection_tile->constant_connection_direction_array[0];
+    Direction discarded_direction;
+    Tile *tile;
+
+    while (true)
+    {
+        increment_pos_in_direction(&current_pos, next_direction);
+        tile = get_side_tile_at_relative_pos(side, &current_pos);
+
+        // the path has left the side
+        if (tile == NULL)
+            break;
+
+        // take the connection that doesn't go backwards
+        discarded_direction = reverse_direction(next_direction);
+        if (tile->nb_of_connections < 2)
+            return NO_PATH_END; // point tile
+        next_direction = (tile->constant_connection_direction_array[0] == discarded_direction) ? tile->constant_connection_direction_array[1] : tile->constant_connection_direction_array[0];
+    }
+
+    for (int tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+        if (tile_idx != missing_connection_tile_idx && are_pos_equal(&(side->missing_connection_tile_array[tile_idx].relative_pos), &current_pos))
+            return tile_idx;
+
+    return NO_PATH_END; // can't happen with valid piece data
+}
+
+// Function to load the path data of the missing connection tiles of a side (see piece_data.h > Side::path_partner_missing_connection_tile_idx_array, Tile::path_end_idx)
+static void load_path_partners(Side *side, int piece_idx)
+{
+    for (int tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+    {
+        side->missing_connection_tile_array[tile_idx].path_end_idx = piece_idx * MAX_NB_OF_MISSING_CONNECTION_PER_SIDE + tile_idx;
+        side->path_partner_missing_connection_tile_idx_array[tile_idx] = get_path_partner_idx(side, tile_idx);
+    }
+}
+
+// Function to count the normal tiles of each type of a side (see piece_data.h > Side::tile_type_counts)
+static void load_tile_type_counts(Side *side)
+{
+    side->tile_type_counts = 0;
+    for (int tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+        side->tile_type_counts += ((uint32_t)1) << TILE_TYPE_COUNT_SHIFT(side->tile_array[tile_idx].tile_type);
+}
+
+// -------------- Border tiles of sides ------------------------------------------------------------------------
+
+// Relative positions of the border tiles of each side (tiles directly in contact with the side, no diagonal), in the same frame as Tile::relative_pos
+// Only read when the placement table is built (see placement.c > "compute_placement" -> Placement::border_tile_mask) and by display.c to debug them,
+// so it is kept out of the Side struct, which is copied in every board
+const Vector2_int side_border_tile_relative_pos_array[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE][MAX_NB_OF_BORDER_TILE_PER_SIDE] = {
+    [LINE2_1] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+    },
+    [LINE2_2] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
+    },
+    [LINE3_1] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+    },
+    [LINE3_2] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
+    },
+    [CORNER_1] = {
+        {{-1, 0}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
+        {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
+    },
+    [CORNER_2] = {
+        {{-1, 0}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
+        {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
+    },
+    [SQUARE] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
+    },
+    [L_PIECE] = {
+        {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 3}, {-1, 2}, {-1, 1}},
+        {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {1, 2}, {0, 3}, {-1, 3}, {-2, 2}, {-1, 1}},
+    },
+    [T_PIECE] = {
+        {{-2, 0}, {-1, -1}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 1}},
+        {{-2, 0}, {-1, -1}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 1}},
+    },
+    [Z_PIECE] = {
+        {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
+        {{-2, 0}, {-1, -1}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
+    },
+};
+
+// -------------- Main function ---------------------------------------------------------------------------------
 
 void load_piece_array(Piece piece_array[NB_OF_PIECES])
 {
     piece_array[LINE2_1] = (Piece){
-        .name = "Line2 1",
         .has_point_on_first_side = true,
-        .piece_height = 1,
         .nb_of_sides = 3,
         .nb_of_border_tiles = 6,
-        .nb_of_outline_tiles = 5,
         .side_array = {
             {
                 .nb_of_tiles = 2,
@@ -45,9 +164,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -62,10 +178,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {2, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
 
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -75,20 +187,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = empty, .relative_pos = {0, 0}, .nb_of_connections = 0},
                     {.tile_type = empty, .relative_pos = {1, 0}, .nb_of_connections = 0},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = 2,
             },
         }};
 
     piece_array[LINE2_2] = (Piece){
-        .name = "Line2 2",
         .has_point_on_first_side = true,
-        .piece_height = 1,
         .nb_of_sides = 3,
         .nb_of_border_tiles = 6,
-        .nb_of_outline_tiles = 5,
         .side_array = {
             {
                 .nb_of_tiles = 2,
@@ -100,9 +206,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {2, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -116,10 +219,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {0, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                     {.tile_type = missing_connection, .relative_pos = {0, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -129,20 +228,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = empty, .relative_pos = {0, 0}, .nb_of_connections = 0},
                     {.tile_type = empty, .relative_pos = {1, 0}, .nb_of_connections = 0},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = 2,
             },
         },
     };
     piece_array[LINE3_1] = (Piece){
-        .name = "Line3 1",
         .has_point_on_first_side = true,
-        .piece_height = 1,
         .nb_of_sides = 3,
         .nb_of_border_tiles = 8,
-        .nb_of_outline_tiles = 5,
         .side_array = {
             {
                 .nb_of_tiles = 3,
@@ -155,9 +248,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {3, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -172,10 +262,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                     {.tile_type = missing_connection, .relative_pos = {2, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -186,20 +272,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = empty, .relative_pos = {1, 0}, .nb_of_connections = 0},
                     {.tile_type = empty, .relative_pos = {2, 0}, .nb_of_connections = 0},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = 2,
             },
         },
     };
     piece_array[LINE3_2] = (Piece){
-        .name = "Line3 2",
         .has_point_on_first_side = true,
-        .piece_height = 1,
         .nb_of_sides = 3,
         .nb_of_border_tiles = 8,
-        .nb_of_outline_tiles = 5,
         .side_array = {
             {
                 .nb_of_tiles = 3,
@@ -212,9 +292,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {2, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -229,10 +306,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                     {.tile_type = missing_connection, .relative_pos = {3, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -243,20 +316,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = empty, .relative_pos = {1, 0}, .nb_of_connections = 0},
                     {.tile_type = empty, .relative_pos = {2, 0}, .nb_of_connections = 0},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, -1}, {3, 0}, {2, 1}, {1, 1}, {0, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {3, 0}, {3, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = 2,
             },
         },
     };
     piece_array[CORNER_1] = (Piece){
-        .name = "Corner 1",
         .has_point_on_first_side = true,
-        .piece_height = 2,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 7,
-        .nb_of_outline_tiles = 7,
         .side_array = {
             {
                 .nb_of_tiles = 3,
@@ -271,10 +338,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                     {.tile_type = missing_connection, .relative_pos = {2, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {1},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -290,21 +353,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {0, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                     {.tile_type = missing_connection, .relative_pos = {-1, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
     piece_array[CORNER_2] = (Piece){
-        .name = "Corner 2",
         .has_point_on_first_side = true,
-        .piece_height = 2,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 7,
-        .nb_of_outline_tiles = 7,
         .side_array = {
             {
                 .nb_of_tiles = 3,
@@ -317,9 +373,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {2, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
 
             },
@@ -335,21 +388,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {0, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                     {.tile_type = missing_connection, .relative_pos = {-2, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
     piece_array[SQUARE] = (Piece){
-        .name = "Square",
         .has_point_on_first_side = true,
-        .piece_height = 2,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 8,
-        .nb_of_outline_tiles = 5,
         .side_array = {
             {
                 .nb_of_tiles = 4,
@@ -365,10 +411,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {1, 2}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                     {.tile_type = missing_connection, .relative_pos = {2, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {1},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -384,21 +426,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {1, -1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                     {.tile_type = missing_connection, .relative_pos = {2, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
     piece_array[L_PIECE] = (Piece){
-        .name = "L piece",
         .has_point_on_first_side = false,
-        .piece_height = 3,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 9,
-        .nb_of_outline_tiles = 7,
         .side_array = {
             {
                 .nb_of_tiles = 4,
@@ -413,10 +448,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                     {.tile_type = missing_connection, .relative_pos = {1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {DOWN}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 3}, {-1, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 2}, {2, 2}, {2, 3}, {0, 3}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -432,21 +463,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                     {.tile_type = missing_connection, .relative_pos = {-2, 2}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, 0}, {1, 1}, {1, 2}, {0, 3}, {-1, 3}, {-2, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {1, 0}, {1, 3}, {-1, 3}, {-1, 2}, {0, 2}, {0, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
     piece_array[T_PIECE] = (Piece){
-        .name = "T piece",
         .has_point_on_first_side = false,
-        .piece_height = 2,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 8,
-        .nb_of_outline_tiles = 9,
         .side_array = {
             {
                 .nb_of_tiles = 4,
@@ -461,10 +485,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {0, 2}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                     {.tile_type = missing_connection, .relative_pos = {1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                 },
-                .border_tile_relative_pos_array = {{-2, 0}, {-1, -1}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{-1, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -482,21 +502,14 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                     {.tile_type = missing_connection, .relative_pos = {-2, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {RIGHT}},
                 },
-                .border_tile_relative_pos_array = {{-2, 0}, {-1, -1}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{-1, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0, 1},
-                .nb_of_susceptible_loop_generator_tiles = 2,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
     piece_array[Z_PIECE] = (Piece){
-        .name = "Z piece",
         .has_point_on_first_side = true,
-        .piece_height = 2,
         .nb_of_sides = 2,
         .nb_of_border_tiles = 8,
-        .nb_of_outline_tiles = 9,
         .side_array = {
             {
                 .nb_of_tiles = 4,
@@ -510,9 +523,6 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                 .missing_connection_tile_array = {
                     {.tile_type = missing_connection, .relative_pos = {0, 2}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                 },
-                .border_tile_relative_pos_array = {{-1, 0}, {0, -1}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 2}, {-2, 1}},
-                .outline_tile_relative_pos_array = {{0, 0}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {-1, 2}, {-1, 1}, {0, 1}, {0, 0}},
-                .nb_of_susceptible_loop_generator_tiles = 0,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
             {
@@ -528,12 +538,19 @@ void load_piece_array(Piece piece_array[NB_OF_PIECES])
                     {.tile_type = missing_connection, .relative_pos = {-1, 1}, .nb_of_connections = 1, .constant_connection_direction_array = {UP}},
                     {.tile_type = missing_connection, .relative_pos = {1, 0}, .nb_of_connections = 1, .constant_connection_direction_array = {LEFT}},
                 },
-                .border_tile_relative_pos_array = {{-2, 0}, {-1, -1}, {0, -1}, {1, 0}, {2, 1}, {1, 2}, {0, 2}, {-1, 1}},
-                .outline_tile_relative_pos_array = {{-1, 0}, {1, 0}, {1, 1}, {2, 1}, {2, 2}, {0, 2}, {0, 1}, {-1, 1}, {-1, 0}},
-                .susceptible_loop_generator_missing_connection_tile_idx_array = {0},
-                .nb_of_susceptible_loop_generator_tiles = 1,
                 .max_nb_of_rotations = NB_OF_DIRECTIONS,
             },
         },
     };
-}
\ No newline at end of file
+
+    // piece index, path data and tile type counts, computed from the data above
+    for (int piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece_array[piece_idx].piece_idx = piece_idx;
+        for (int side_idx = 0; side_idx < piece_array[piece_idx].nb_of_sides; side_idx++)
+        {
+            load_path_partners((piece_array[piece_idx].side_array) + side_idx, piece_idx);
+            load_tile_type_counts((piece_array[piece_idx].side_array) + side_idx);
+        }
+    }
+}
@@ -0,0 +1,314 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file placement.c
+ *
+ * Precomputed table of every blit of every piece side on the board (see placement.h > Placement)
+ *
+ * The search algorithm tries the same blits over and over again, (piece, side, base_pos, rotation_state) => always the same tile positions and connections
+ * So we compute them once at startup, and we also drop the blits that don't even fit inside the board
+ * (these were most of the iterations of the nested side / i / j / rotation loops, and all of them ended in OUT_OF_BOUNDS)
+ */
+
+#include <stdbool.h>
+#include <stdint.h> // uint32_t
+
+#include <local/utils.h>               // Vector2_int, helper functions, bitboard macros
+#include <local/piece_data.h>          // Tile, Side, Piece, load_piece_array, side_border_tile_relative_pos_array, and defines
+#include <local/transposition_table.h> // zobrist_keys, load_zobrist_keys
+#include <local/region_shapes.h>       // load_region_shape_table
+
+#include <local/placement.h>
+
+PlacementTable placement_table;
+
+static bool is_placement_table_loaded = false;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// same computation as piece.h > "tile_absolute_pos_computation" macro
+static Vector2_int get_absolute_pos(Vector2_int relative_pos, int rotation_state, Vector2_int base_pos)
+{
+    rotate_pos(&relative_pos, rotation_state);
+    translate_pos(&relative_pos, &base_pos);
+    return relative_pos;
+}
+
+// Function to fill the placement of a piece side blit
+// Returns false if any of the tiles are out of bounds (the placement is then garbage and must be discarded)
+static bool compute_placement(Placement *placement, Piece *piece, int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state)
+{
+    Side *side = (piece->side_array) + side_idx;
+    Tile *tile;
+    Vector2_int pos;
+    Direction direction;
+    int tile_idx, connection_idx;
+
+    placement->piece_idx = piece_idx;
+    placement->side_idx = side_idx;
+    placement->rotation_state = rotation_state;
+    placement->base_pos = base_pos;
+
+    placement->tile_mask = 0;
+    placement->missing_connection_tile_mask = 0;
+    placement->border_tile_mask = 0;
+    placement->point_tile_mask = 0;
+
+    placement->zobrist_key = zobrist_keys.added_piece_key_array[piece_idx];
+    if (side_idx == 0 && piece->has_point_on_first_side)
+        placement->zobrist_key ^= zobrist_keys.combination_piece_key_array[piece_idx];
+
+    for (tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+    {
+        tile = (side->tile_array) + tile_idx;
+        pos = get_absolute_pos(tile->relative_pos, rotation_state, base_pos);
+        if (!is_pos_inside_board(&pos))
+            return false;
+
+        placement->tile_bit_idx_array[tile_idx] = POS_TO_BIT_IDX(pos.i, pos.j);
+        placement->tile_mask |= POS_TO_BIT_MASK(&pos);
+        if (tile->tile_type == point)
+            placement->point_tile_mask = POS_TO_BIT_MASK(&pos);
+
+        placement->tile_connection_mask_array[tile_idx] = 0;
+        for (connection_idx = 0; connection_idx < tile->nb_of_connections; connection_idx++)
+        {
+            direction = rotate_direction(tile->constant_connection_direction_array[connection_idx], rotation_state);
+            placement->tile_connection_direction_array[tile_idx][connection_idx] = direction;
+            placement->tile_connection_mask_array[tile_idx] |= DIRECTION_TO_MASK(direction);
+        }
+        placement->zobrist_key ^= zobrist_keys.normal_tile_key_array[placement->tile_bit_idx_array[tile_idx]][placement->tile_connection_mask_array[tile_idx]];
+    }
+
+    for (tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+    {
+        tile = (side->missing_connection_tile_array) + tile_idx;
+        pos = get_absolute_pos(tile->relative_pos, rotation_state, base_pos);
+        if (!is_pos_inside_board(&pos))
+            return false;
+
+        placement->missing_connection_tile_bit_idx_array[tile_idx] = POS_TO_BIT_IDX(pos.i, pos.j);
+        placement->missing_connection_tile_mask |= POS_TO_BIT_MASK(&pos);
+        placement->missing_connection_tile_direction_array[tile_idx] = rotate_direction(tile->constant_connection_direction_array[0], rotation_state);
+    }
+
+    // border tiles can be out of bounds, they are just not part of the mask
+    for (tile_idx = 0; tile_idx < piece->nb_of_border_tiles; tile_idx++)
+    {
+        pos = get_absolute_pos(side_border_tile_relative_pos_array[piece_idx][side_idx][tile_idx], rotation_state, base_pos);
+        if (is_pos_inside_board(&pos))
+            placement->border_tile_mask |= POS_TO_BIT_MASK(&pos);
+    }
+
+    return true;
+}
+
+// Function to append all the valid placements of a piece side, with rotation_state in [first_rotation_state, last_rotation_state[
+static void append_side_placements(Piece *piece, int piece_idx, int side_idx, int first_rotation_state, int last_rotation_state)
+{
+    Vector2_int base_pos;
+    int rotation_state;
+    Placement *placement;
+
+    for (base_pos.i = 0; base_pos.i < BOARD_WIDTH; base_pos.i++)
+    {
+        for (base_pos.j = 0; base_pos.j < BOARD_HEIGHT; base_pos.j++)
+        {
+            for (rotation_state = first_rotation_state; rotation_state < last_rotation_state; rotation_state++)
+            {
+                placement = (placement_table.placement_array) + placement_table.nb_of_placements;
+                if (!compute_placement(placement, piece, piece_idx, side_idx, base_pos, rotation_state))
+                    continue;
+
+                placement_table.placement_idx_lookup[piece_idx][side_idx][base_pos.i][base_pos.j][rotation_state] = placement_table.nb_of_placements;
+                placement_table.nb_of_placements++;
+            }
+        }
+    }
+}
+
+// Function to index the placements explored by the search algorithm by the positions they cover (see placement.h > PlacementTable)
+static void load_covering_placements(void)
+{
+    int nb_of_covering_placements = 0;
+    int bit_idx, piece_idx, placement_idx;
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        {
+            placement_table.first_covering_placement_idx_array[bit_idx][piece_idx] = nb_of_covering_placements;
+            for (placement_idx = placement_table.first_placement_idx_array[piece_idx][0]; placement_idx < placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE]; placement_idx++)
+            {
+                if (!(placement_table.placement_array[placement_idx].tile_mask & (((uint32_t)1) << bit_idx)))
+                    continue;
+
+                placement_table.covering_placement_idx_array[nb_of_covering_placements] = placement_idx;
+                nb_of_covering_placements++;
+            }
+        }
+        placement_table.first_covering_placement_idx_array[bit_idx][NB_OF_PIECES] = nb_of_covering_placements;
+    }
+}
+
+// Function to index the placements explored by the search algorithm that have a point tile, by the position of their point tile (see placement.h > PlacementTable)
+static void load_point_placements(void)
+{
+    int nb_of_point_placements = 0;
+    int bit_idx, piece_idx, placement_idx;
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        {
+            placement_table.first_point_placement_idx_array[bit_idx][piece_idx] = nb_of_point_placements;
+            for (placement_idx = placement_table.first_placement_idx_array[piece_idx][0]; placement_idx < placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE]; placement_idx++)
+            {
+                if (!(placement_table.placement_array[placement_idx].point_tile_mask & (((uint32_t)1) << bit_idx)))
+                    continue;
+
+                placement_table.point_placement_idx_array[nb_of_point_placements] = placement_idx;
+                nb_of_point_placements++;
+            }
+        }
+        placement_table.first_point_placement_idx_array[bit_idx][NB_OF_PIECES] = nb_of_point_placements;
+    }
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to load the number of tiles of every subset of pieces, and the sizes that they can fill (see placement.h > PlacementTable)
+// A subset is its smallest piece + the rest of the subset (which is a smaller number, so it is already computed) :
+// the sizes reachable with the subset are the ones of the rest, with or without the tiles of the smallest piece
+static void load_subset_sizes(Piece piece_array[NB_OF_PIECES])
+{
+    int piece_mask, piece_idx, rest_piece_mask, nb_of_tiles;
+
+    placement_table.subset_nb_of_tiles_array[0] = 0;
+    placement_table.subset_size_mask_array[0] = 1; // the empty subset fills 0 tiles
+
+    for (piece_mask = 1; piece_mask < (1 << NB_OF_PIECES); piece_mask++)
+    {
+        piece_idx = LOWEST_BIT_IDX(piece_mask);
+        rest_piece_mask = piece_mask & (piece_mask - 1);
+        nb_of_tiles = piece_array[piece_idx].side_array[0].nb_of_tiles;
+
+        placement_table.subset_nb_of_tiles_array[piece_mask] = placement_table.subset_nb_of_tiles_array[rest_piece_mask] + nb_of_tiles;
+        placement_table.subset_size_mask_array[piece_mask] = placement_table.subset_size_mask_array[rest_piece_mask] | (placement_table.subset_size_mask_array[rest_piece_mask] << nb_of_tiles);
+    }
+}
+
+// Function to load the colour imbalances that every subset of pieces can have on the board (see placement.h > PlacementTable)
+// 1) the imbalances of a piece are the ones of its placements (it depends on the side, and on the colour of the tile the piece is placed on)
+// 2) same dynamic programming as "load_subset_sizes" : the imbalances of the subset are the ones of the rest, shifted by each imbalance of its smallest piece
+// (the pieces have BOARD_TOTAL_NB_TILES tiles in total, so no imbalance is lost by the shifts)
+static void load_subset_colour_imbalances(void)
+{
+    uint64_t piece_colour_imbalance_mask_array[NB_OF_PIECES];
+    uint64_t rest_colour_imbalance_mask, subset_colour_imbalance_mask;
+    int piece_mask, piece_idx, rest_piece_mask, placement_idx, imbalance;
+
+    // 1)
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece_colour_imbalance_mask_array[piece_idx] = 0;
+        for (placement_idx = placement_table.first_placement_idx_array[piece_idx][0]; placement_idx < placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE]; placement_idx++)
+            piece_colour_imbalance_mask_array[piece_idx] |= COLOUR_IMBALANCE_TO_BIT_MASK(COLOUR_IMBALANCE_OF_MASK(placement_table.placement_array[placement_idx].tile_mask));
+    }
+
+    // 2)
+    placement_table.subset_colour_imbalance_mask_array[0] = COLOUR_IMBALANCE_TO_BIT_MASK(0);
+
+    for (piece_mask = 1; piece_mask < (1 << NB_OF_PIECES); piece_mask++)
+    {
+        piece_idx = LOWEST_BIT_IDX(piece_mask);
+        rest_piece_mask = piece_mask & (piece_mask - 1);
+        rest_colour_imbalance_mask = placement_table.subset_colour_imbalance_mask_array[rest_piece_mask];
+        subset_colour_imbalance_mask = 0;
+
+        for (imbalance = -MAX_NB_OF_TILE_PER_SIDE; imbalance <= MAX_NB_OF_TILE_PER_SIDE; imbalance++)
+        {
+            if (!(piece_colour_imbalance_mask_array[piece_idx] & COLOUR_IMBALANCE_TO_BIT_MASK(imbalance)))
+                continue;
+
+            if (imbalance >= 0)
+                subset_colour_imbalance_mask |= rest_colour_imbalance_mask << imbalance;
+            else
+                subset_colour_imbalance_mask |= rest_colour_imbalance_mask >> (-imbalance);
+        }
+
+        placement_table.subset_colour_imbalance_mask_array[piece_mask] = subset_colour_imbalance_mask;
+    }
+}
+
+// Function to build the placement table, only the first call does something
+// (it is the same for every level and every board, so it is called when a board is initialized)
+void load_placement_table(void)
+{
+    Piece piece_array[NB_OF_PIECES];
+    Piece *piece;
+    int piece_idx, side_idx, i, j, rotation_state;
+
+    if (is_placement_table_loaded)
+        return;
+
+    load_piece_array(piece_array);
+    load_zobrist_keys();
+
+    placement_table.nb_of_placements = 0;
+
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        for (side_idx = 0; side_idx < MAX_NB_OF_SIDE_PER_PIECE; side_idx++)
+            for (i = 0; i < BOARD_WIDTH; i++)
+                for (j = 0; j < BOARD_HEIGHT; j++)
+                    for (rotation_state = 0; rotation_state < NB_OF_DIRECTIONS; rotation_state++)
+                        placement_table.placement_idx_lookup[piece_idx][side_idx][i][j][rotation_state] = UNDEFINED_PLACEMENT_IDX;
+
+    // 1) placements explored by the search algorithm, in the same order as its nested loops
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece = piece_array + piece_idx;
+        for (side_idx = 0; side_idx < MAX_NB_OF_SIDE_PER_PIECE; side_idx++)
+        {
+            placement_table.first_placement_idx_array[piece_idx][side_idx] = placement_table.nb_of_placements;
+            if (side_idx < piece->nb_of_sides)
+                append_side_placements(piece, piece_idx, side_idx, 0, piece->side_array[side_idx].max_nb_of_rotations);
+        }
+        placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE] = placement_table.nb_of_placements;
+    }
+
+    // 2) redundant rotations of symmetric sides
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece = piece_array + piece_idx;
+        for (side_idx = 0; side_idx < piece->nb_of_sides; side_idx++)
+            append_side_placements(piece, piece_idx, side_idx, piece->side_array[side_idx].max_nb_of_rotations, NB_OF_DIRECTIONS);
+    }
+
+    // 3) position -> covering placements index (of the placements of 1))
+    load_covering_placements();
+
+    // 3 bis) point position -> point placements index (of the placements of 1))
+    load_point_placements();
+
+    // 4) piece subsets -> sizes
+    load_subset_sizes(piece_array);
+
+    // 5) piece subsets -> colour imbalances (of the placements of 1))
+    load_subset_colour_imbalances();
+
+    is_placement_table_loaded = true;
+
+    // 6) small region shapes -> piece subsets that can fill them (it needs the placements of 1) and 2), see region_shapes.c)
+    load_region_shape_table();
+}
+
+// Returns the index in placement_table.placement_array of the input blit, or UNDEFINED_PLACEMENT_IDX if it doesn't fit inside the board
+int get_placement_idx(int piece_idx, int side_idx, Vector2_int base_pos, int rotation_state)
+{
+    if (side_idx < 0 || side_idx >= MAX_NB_OF_SIDE_PER_PIECE || rotation_state < 0 || rotation_state >= NB_OF_DIRECTIONS || !is_pos_inside_board(&base_pos))
+        return UNDEFINED_PLACEMENT_IDX;
+
+    return placement_table.placement_idx_lookup[piece_idx][side_idx][base_pos.i][base_pos.j][rotation_state];
+}
@@ -0,0 +1,278 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file region_shapes.c
+ *
+ * Table of the small empty region shapes, and of the subsets of pieces that can fill them (see check_board.c > "check_small_region_shapes")
+ *
+ * Explanation :
+ *
+ *      "check_isolated_tiles_around_piece" only catches holes of 1 tile, and "check_region_sizes" only looks at the number of tiles of each region.
+ *      But a small hole has to be filled by pieces that have its exact shape : an L-shaped hole of 3 tiles can only be filled by a corner piece,
+ *      a straight one only by a line piece, and a 2x2 hole only by the square piece.
+ *
+ *      A small region doesn't have many possible shapes, so all of them (up to MAX_NB_OF_TILES_PER_SMALL_REGION tiles) are computed once, when the placement table is loaded :
+ *      1) the footprints of each piece are the normal tile masks of its placements (see placement.h), moved to the top left corner of the board
+ *         (a footprint that can't be placed anywhere, because of its missing connection tiles, can't fill anything anyway)
+ *      2) the shapes of n tiles are the shapes of n - 1 tiles, with 1 more tile around them, as long as it fits inside the board
+ *      3) the subsets of pieces that can fill a shape are found like in anchor_search.c : the first tile of the shape (in bit index order) has to be covered by the first tile of a footprint,
+ *         and the rest of the shape is filled recursively by the other pieces
+ *
+ *      The shapes only depend on the footprints, not on where the region is, so a region at the edge of the board may have fewer ways to be filled than its shape :
+ *      the table only tells which subsets can't fill a region, it is a necessary condition.
+ */
+
+#include <stdbool.h>
+#include <stdint.h> // int16_t, uint8_t, uint32_t
+
+#include <local/utils.h>      // bitboard macros and defines
+#include <local/piece_data.h> // NB_OF_PIECES, MAX_NB_OF_SIDE_PER_PIECE
+#include <local/placement.h>  // placement_table
+
+#include <local/region_shapes.h>
+
+#define MAX_NB_OF_FOOTPRINTS_PER_PIECE (MAX_NB_OF_SIDE_PER_PIECE * NB_OF_DIRECTIONS)
+
+/**
+ * @struct Footprint
+ * Normal tiles of a piece side in one of its rotations, moved to the top left corner of the board
+ */
+typedef struct Footprint
+{
+    uint32_t tile_mask;
+    int first_row; // row of the first tile (in bit index order), which is in the first column
+    int nb_of_columns;
+    int nb_of_rows;
+
+} Footprint;
+
+RegionShapeTable region_shape_table;
+
+static bool is_region_shape_table_loaded = false;
+
+// loading data
+static Footprint footprint_array[NB_OF_PIECES][MAX_NB_OF_FOOTPRINTS_PER_PIECE];
+static int nb_of_footprints_array[NB_OF_PIECES];
+static uint32_t shape_list[REGION_SHAPE_HASH_TABLE_SIZE]; // all shapes, by increasing number of tiles
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// Returns the mask of the rows that have at least one tile of the input mask, in the first column
+static uint32_t get_row_mask(uint32_t mask)
+{
+    mask |= mask >> 16;
+    mask |= mask >> 8;
+    mask |= mask >> 4;
+
+    return mask & ((1 << BOARD_HEIGHT) - 1);
+}
+
+// Returns the tile mask of a non-empty region moved to the top left corner of the board (its first column and its first row aren't empty)
+static uint32_t get_shape_mask(uint32_t region_mask)
+{
+    region_mask >>= (LOWEST_BIT_IDX(region_mask) / BOARD_HEIGHT) * BOARD_HEIGHT;
+
+    // no column has a tile above the first non-empty row, so the columns can't overlap
+    return region_mask >> LOWEST_BIT_IDX(get_row_mask(region_mask));
+}
+
+// Returns the slot of the shape in the hash table, or the empty slot where it would be (see region_shapes.h > RegionShapeTable)
+static int get_shape_slot(uint32_t shape_mask)
+{
+    int slot = (int)((shape_mask * 2654435761u) >> (32 - REGION_SHAPE_HASH_TABLE_SIZE_LOG2));
+
+    while (region_shape_table.shape_mask_array[slot] != 0 && region_shape_table.shape_mask_array[slot] != shape_mask)
+        slot = (slot + 1) & (REGION_SHAPE_HASH_TABLE_SIZE - 1);
+
+    return slot;
+}
+
+// Function to get the number of columns and rows that a shape takes
+static void get_shape_dimensions(uint32_t shape_mask, int *nb_of_columns, int *nb_of_rows)
+{
+    *nb_of_columns = (31 - __builtin_clz(shape_mask)) / BOARD_HEIGHT + 1;
+    *nb_of_rows = 32 - __builtin_clz(get_row_mask(shape_mask));
+}
+
+// -------------- Loading steps ---------------------------------------------------------------------------------
+
+// 1) Function to load the distinct footprints of each piece, from the placements of the placement table
+static void load_footprints(void)
+{
+    Placement *placement;
+    Footprint *footprint;
+    uint32_t shape_mask;
+    int piece_idx, footprint_idx;
+
+    for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        nb_of_footprints_array[piece_idx] = 0;
+
+    for (int placement_idx = 0; placement_idx < placement_table.nb_of_placements; placement_idx++)
+    {
+        placement = (placement_table.placement_array) + placement_idx;
+        piece_idx = placement->piece_idx;
+        shape_mask = get_shape_mask(placement->tile_mask);
+
+        for (footprint_idx = 0; footprint_idx < nb_of_footprints_array[piece_idx]; footprint_idx++)
+            if (footprint_array[piece_idx][footprint_idx].tile_mask == shape_mask)
+                break;
+
+        if (footprint_idx < nb_of_footprints_array[piece_idx])
+            continue;
+
+        footprint = footprint_array[piece_idx] + footprint_idx;
+        footprint->tile_mask = shape_mask;
+        footprint->first_row = LOWEST_BIT_IDX(shape_mask);
+        get_shape_dimensions(shape_mask, &(footprint->nb_of_columns), &(footprint->nb_of_rows));
+        nb_of_footprints_array[piece_idx]++;
+    }
+}
+
+// 2) Function to list all the shapes of 1 to MAX_NB_OF_TILES_PER_SMALL_REGION tiles that fit inside the board, and to give them a slot in the hash table
+// Returns the number of shapes
+static int load_shapes(void)
+{
+    int nb_of_shapes = 1, first_shape_idx = 0, last_shape_idx;
+    int nb_of_columns, nb_of_rows, i, j, slot;
+    uint32_t translated_shape_mask, new_tile_mask, shape_mask;
+
+    for (slot = 0; slot < REGION_SHAPE_HASH_TABLE_SIZE; slot++)
+    {
+        region_shape_table.shape_mask_array[slot] = 0;
+        region_shape_table.first_tiling_idx_array[slot] = 0;
+        region_shape_table.nb_of_tilings_array[slot] = 0; // (a region that isn't in the table can't be filled)
+    }
+
+    // the shape of 1 tile
+    shape_list[0] = 1;
+    region_shape_table.shape_mask_array[get_shape_slot(1)] = 1;
+
+    for (int nb_of_tiles = 2; nb_of_tiles <= MAX_NB_OF_TILES_PER_SMALL_REGION; nb_of_tiles++)
+    {
+        last_shape_idx = nb_of_shapes;
+
+        // every position of every shape of nb_of_tiles - 1 tiles, with 1 more tile around it
+        for (int shape_idx = first_shape_idx; shape_idx < last_shape_idx; shape_idx++)
+        {
+            get_shape_dimensions(shape_list[shape_idx], &nb_of_columns, &nb_of_rows);
+
+            for (i = 0; i + nb_of_columns <= BOARD_WIDTH; i++)
+            {
+                for (j = 0; j + nb_of_rows <= BOARD_HEIGHT; j++)
+                {
+                    translated_shape_mask = shape_list[shape_idx] << POS_TO_BIT_IDX(i, j);
+
+                    for (new_tile_mask = NEIGHBOUR_MASK(translated_shape_mask) & ~translated_shape_mask; new_tile_mask; new_tile_mask &= new_tile_mask - 1)
+                    {
+                        shape_mask = get_shape_mask(translated_shape_mask | (((uint32_t)1) << LOWEST_BIT_IDX(new_tile_mask)));
+                        slot = get_shape_slot(shape_mask);
+                        if (region_shape_table.shape_mask_array[slot] != 0)
+                            continue;
+
+                        region_shape_table.shape_mask_array[slot] = shape_mask;
+                        shape_list[nb_of_shapes] = shape_mask;
+                        nb_of_shapes++;
+                    }
+                }
+            }
+        }
+
+        first_shape_idx = last_shape_idx;
+    }
+
+    return nb_of_shapes;
+}
+
+// 3) Function to record the subsets of pieces that can fill the rest of a shape ("remaining_tile_mask"), the pieces of "piece_mask" being already used
+// The first tile of the rest of the shape has to be covered by the first tile of a footprint of 1 of the other pieces
+static void record_tilings(int slot, uint32_t remaining_tile_mask, int piece_mask)
+{
+    int anchor_bit_idx, anchor_row, tiling_idx, last_tiling_idx;
+    uint32_t tile_mask;
+    Footprint *footprint;
+
+    if (remaining_tile_mask == 0)
+    {
+        // the same subset may fill the shape in several ways
+        last_tiling_idx = region_shape_table.first_tiling_idx_array[slot] + region_shape_table.nb_of_tilings_array[slot];
+        for (tiling_idx = region_shape_table.first_tiling_idx_array[slot]; tiling_idx < last_tiling_idx; tiling_idx++)
+            if (region_shape_table.tiling_piece_mask_array[tiling_idx] == piece_mask)
+                return;
+
+        region_shape_table.tiling_piece_mask_array[region_shape_table.nb_of_tilings] = piece_mask;
+        region_shape_table.nb_of_tilings++;
+        region_shape_table.nb_of_tilings_array[slot]++;
+        return;
+    }
+
+    anchor_bit_idx = LOWEST_BIT_IDX(remaining_tile_mask);
+    anchor_row = anchor_bit_idx % BOARD_HEIGHT;
+
+    for (int piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        if (piece_mask & (1 << piece_idx))
+            continue;
+
+        for (int footprint_idx = 0; footprint_idx < nb_of_footprints_array[piece_idx]; footprint_idx++)
+        {
+            footprint = footprint_array[piece_idx] + footprint_idx;
+
+            // the footprint must stay inside the board, with its first tile on the anchor
+            if (anchor_row < footprint->first_row || anchor_row - footprint->first_row + footprint->nb_of_rows > BOARD_HEIGHT ||
+                anchor_bit_idx / BOARD_HEIGHT + footprint->nb_of_columns > BOARD_WIDTH)
+                continue;
+
+            tile_mask = footprint->tile_mask << (anchor_bit_idx - footprint->first_row);
+            if (tile_mask & ~remaining_tile_mask)
+                continue;
+
+            record_tilings(slot, remaining_tile_mask & ~tile_mask, piece_mask | (1 << piece_idx));
+        }
+    }
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to build the region shape table, only the first call does something
+// It needs the placement table (see placement.c > "load_placement_table", which calls it)
+void load_region_shape_table(void)
+{
+    int nb_of_shapes, slot;
+
+    if (is_region_shape_table_loaded)
+        return;
+
+    // 1)
+    load_footprints();
+
+    // 2)
+    nb_of_shapes = load_shapes();
+
+    // 3)
+    region_shape_table.nb_of_tilings = 0;
+    for (int shape_idx = 0; shape_idx < nb_of_shapes; shape_idx++)
+    {
+        slot = get_shape_slot(shape_list[shape_idx]);
+        region_shape_table.first_tiling_idx_array[slot] = region_shape_table.nb_of_tilings;
+        region_shape_table.nb_of_tilings_array[slot] = 0;
+        record_tilings(slot, shape_list[shape_idx], 0);
+    }
+
+    is_region_shape_table_loaded = true;
+}
+
+// Function to find out if some of the pieces of "piece_mask" can fill an empty region of 1 to MAX_NB_OF_TILES_PER_SMALL_REGION connected tiles, given its shape
+// Returns false if they surely can't
+bool can_small_region_be_filled(uint32_t region_mask, int piece_mask)
+{
+    int slot = get_shape_slot(get_shape_mask(region_mask));
+    int first_tiling_idx = region_shape_table.first_tiling_idx_array[slot];
+    int last_tiling_idx = first_tiling_idx + region_shape_table.nb_of_tilings_array[slot];
+
+    for (int tiling_idx = first_tiling_idx; tiling_idx < last_tiling_idx; tiling_idx++)
+        if (!(region_shape_table.tiling_piece_mask_array[tiling_idx] & ~piece_mask))
+            return true;
+
+    return false;
+}
@@ -0,0 +1,161 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file savestate.c
+ *
+ * Board savestates shared between consecutive combinations (an upgrade that was drafted in potential_upgrades/README.md)
+ *
+ * Explanation :
+ *
+ *      Consecutive combinations often start with the same pieces (see utils.c > "generate_next_combination"),
+ *      ex : with 4 open points, {Z, T, L, SQUARE} is followed by {Z, T, L, CORNER_2}.
+ *      To explore the next combination, the algorithm used to rebuild from scratch all the valid boards made of the common starting pieces,
+ *      which are the exact same boards as in the previous combination (the checks only depend on the board, and the pieces are added in the same order).
+ *
+ *      1) Recording
+ *
+ *      Each time a piece is added at one of the first depths (depth = index in piece_idx_priority_array), the valid board is recorded as a savestate :
+ *      the placement of the piece + the savestate of the previous depth it was added on (like a tree, so that a savestate takes a few bytes).
+ *      Only the depths lower than (nb of open points - 1) are recorded :
+ *      2 different combinations have different sets of point pieces, so they can't have more common starting pieces than that.
+ *
+ *      2) Resuming
+ *
+ *      When a new combination starts, its number of common starting pieces with the recorded ones is its "similarity depth".
+ *      Instead of starting from depth 0, the algorithm loads each savestate of the last common depth one after the other (in the order they were found),
+ *      and explores the rest of the combination from it, as if it had just reached this board.
+ *      The savestates of the common depths are kept, the deeper ones are replaced by the ones of the new combination.
+ *
+ *      The boards are visited in the same order as before, so the same solution is found, only the replayed boards are not counted as valid boards anymore.
+ *      The combination skipping trick (see search_algorithm.c > "is_current_combination_skippable") still works the same,
+ *      the max depth of a resumed combination is at least the similarity depth, as it would have been reached from scratch.
+ *
+ *      If a depth has more valid boards than a savestate array can hold, it is not used to resume a combination (starting deeper than the previous depths is fine).
+ *
+ *      Placements have to be replayed with "add_placement_to_board", because a board can't be copied (its tiles point to its own pieces),
+ *      but it skips all the checks, and all the failing placements in between.
+ */
+
+#include <stdbool.h>
+#include <stdio.h> // printf
+
+#include <local/piece_data.h> // NB_OF_PIECES
+#include <local/board.h>      // Board, add_placement_to_board, undo_last_piece_adding
+#include <local/placement.h>  // UNDEFINED_PLACEMENT_IDX
+
+#include <local/savestate.h>
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// Function to remove the replayed savestate from the board (the board is back to its state at the start of the combination)
+static void unload_savestate(SavestateMemory *savestates, Board *board)
+{
+    for (int depth = savestates->similarity_depth - 1; depth >= 0; depth--)
+    {
+        undo_last_piece_adding(board);
+        board->piece_array[savestates->piece_idx_priority_array[depth]].current_placement_idx = UNDEFINED_PLACEMENT_IDX;
+    }
+}
+
+// Function to replay the placements of a savestate on the board, from the first depth
+static void load_savestate(SavestateMemory *savestates, Board *board, int depth, int savestate_idx)
+{
+    if (depth < 0)
+        return;
+
+    load_savestate(savestates, board, depth - 1, savestates->savestate_array[depth][savestate_idx].parent_savestate_idx);
+    add_placement_to_board(board, savestates->savestate_array[depth][savestate_idx].placement_idx);
+    savestates->current_savestate_idx_array[depth] = savestate_idx;
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to call each time the search algorithm starts to explore a new combination
+// Forgets the savestates that are not shared with the new combination
+// Returns the similarity depth of the combination, the number of starting pieces that "load_next_savestate" will replay (0 if the combination starts from scratch)
+int start_combination_from_savestates(SavestateMemory *savestates, int piece_idx_priority_array[NB_OF_PIECES], int nb_of_open_points)
+{
+    int similarity_depth = 0;
+    int depth;
+
+    // only the last common depth that has been completely recorded, and that has valid boards, can be resumed from
+    // (if a common depth has no valid boards at all, the last one that has some is resumed from, the next piece will simply fail on all of them again)
+    for (depth = 0; depth < savestates->nb_of_savestate_depths; depth++)
+    {
+        if (piece_idx_priority_array[depth] != savestates->piece_idx_priority_array[depth] || !savestates->is_complete_array[depth])
+            break;
+        if (savestates->nb_of_savestates_array[depth] != 0)
+            similarity_depth = depth + 1;
+    }
+
+    // the deeper savestates are recorded again with the pieces of the new combination
+    savestates->nb_of_savestate_depths = nb_of_open_points - 1;
+    if (savestates->nb_of_savestate_depths < 0)
+        savestates->nb_of_savestate_depths = 0;
+    if (savestates->nb_of_savestate_depths > MAX_NB_OF_SAVESTATE_DEPTHS)
+        savestates->nb_of_savestate_depths = MAX_NB_OF_SAVESTATE_DEPTHS;
+
+    for (depth = similarity_depth; depth < savestates->nb_of_savestate_depths; depth++)
+    {
+        savestates->piece_idx_priority_array[depth] = piece_idx_priority_array[depth];
+        savestates->nb_of_savestates_array[depth] = 0;
+        savestates->is_complete_array[depth] = true;
+    }
+
+    savestates->similarity_depth = similarity_depth;
+    savestates->loaded_savestate_idx = -1;
+    if (similarity_depth > 0)
+        savestates->nb_of_resumed_combinations++;
+
+    return similarity_depth;
+}
+
+// Function to record the current board as a savestate, "placement_idx" being the placement of the piece that has just been added at "depth"
+void record_savestate(SavestateMemory *savestates, int depth, int placement_idx)
+{
+    Savestate *savestate;
+
+    if (depth >= savestates->nb_of_savestate_depths)
+        return;
+
+    if (savestates->nb_of_savestates_array[depth] == MAX_NB_OF_SAVESTATES_PER_DEPTH)
+    {
+        savestates->is_complete_array[depth] = false;
+        return;
+    }
+
+    savestate = savestates->savestate_array[depth] + savestates->nb_of_savestates_array[depth];
+    savestate->placement_idx = placement_idx;
+    savestate->parent_savestate_idx = (depth == 0) ? NO_PARENT_SAVESTATE : savestates->current_savestate_idx_array[depth - 1];
+
+    savestates->current_savestate_idx_array[depth] = savestates->nb_of_savestates_array[depth];
+    savestates->nb_of_savestates_array[depth]++;
+}
+
+// Function to replace the replayed savestate on the board by the next one, at the similarity depth of the current combination
+// Returns false if all of them have been explored (the board is then back to its state at the start of the combination)
+bool load_next_savestate(SavestateMemory *savestates, Board *board)
+{
+    int depth = savestates->similarity_depth - 1;
+
+    if (depth < 0)
+        return false;
+
+    if (savestates->loaded_savestate_idx >= 0 && savestates->loaded_savestate_idx < savestates->nb_of_savestates_array[depth])
+        unload_savestate(savestates, board);
+
+    savestates->loaded_savestate_idx++;
+    if (savestates->loaded_savestate_idx >= savestates->nb_of_savestates_array[depth])
+        return false;
+
+    load_savestate(savestates, board, depth, savestates->loaded_savestate_idx);
+    savestates->nb_of_loaded_savestates++;
+    return true;
+}
+
+// Function to print how much the combinations have been resumed from savestates, on the current line
+void print_savestate_stats(SavestateMemory *savestates)
+{
+    printf("%d resumed combinations, %d loaded savestates", savestates->nb_of_resumed_combinations, savestates->nb_of_loaded_savestates);
+}
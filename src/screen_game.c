@@ -19,6 +19,7 @@
 #include <local/level_data.h>
 #include <local/piece.h>
 #include <local/check_board.h> // run_all_checks
+#include <local/solver_context.h> // SolverContext, init_solver_context
 #include <local/display.h>
 #include <local/utils.h> // assets_folder_relative_path
 
@@ -48,6 +49,8 @@ static bool is_piece_idx_already_played(int piece_idx);
 static int get_next_piece_idx(int piece_idx);
 
 static Board *board;
+static BoardDrawing *board_drawing; // drawing data of the board, allocated and freed with it (see display.h)
+static SolverContext *context; // work memory of the checks, see solver_context.h
 static LevelHints *level_hints;
 static Piece *current_piece;
 static Controls controls;
@@ -63,7 +66,9 @@ void InitGameScreen(void)
 {
     level_hints = get_level_hints(level_num_selected);
     board = init_board(level_hints);
-    update_board_static_drawing(board);
+    board_drawing = init_board_drawing();
+    context = init_solver_context();
+    update_board_static_drawing(board, board_drawing);
 
     reset_controls();
 
@@ -178,13 +183,13 @@ void UpdateGameScreen(void)
                 return;
 
             // case where it has been successfully added, but is the board still worth continuing ? -> post-adding checks
-            error_status = run_all_checks(board, true);
+            error_status = run_all_checks(board, context, true);
 
             if (error_status != ADD_SUCCESS)
             {
                 // Answer : no, so remove the piece from the board
                 undo_last_piece_adding(board);
-                error_status += 10; // see display.c > draw_board_validation
+                error_status += POST_ADDING_CHECK_STATUS_OFFSET; // see display.c > draw_board_validation
                 return;
             }
 
@@ -217,10 +222,10 @@ void DrawGameScreen(void)
 {
     ClearBackground(BLACK);
 
-    draw_board(board);
+    draw_board(board, board_drawing);
 
     if (current_piece != NULL)
-        draw_piece(current_piece, false, false);
+        draw_piece(current_piece, (board_drawing->piece_drawing_array) + controls.piece_idx, false, false);
 
     // UI
     draw_level_num(level_num_selected);
@@ -233,6 +238,8 @@ void DrawGameScreen(void)
 void UnloadGameScreen(void)
 {
 
+    free(context);
+    free(board_drawing);
     free(board);
     free(level_hints);
 }
@@ -328,5 +335,5 @@ static void update_current_piece(void)
 {
     current_piece = (board->piece_array) + controls.piece_idx;
     blit_piece_main_data(current_piece, controls.side_idx, controls.base_pos, controls.rotation_state);
-    update_piece_all_drawing(current_piece, false, false);
+    update_piece_all_drawing(current_piece, (board_drawing->piece_drawing_array) + controls.piece_idx, false, false);
 }
\ No newline at end of file
@@ -24,6 +24,8 @@
 #include <local/level_data.h> // PieceAddInfos
 #include <local/piece.h>
 #include <local/check_board.h> // run_all_checks
+#include <local/solver_context.h> // SolverContext, init_solver_context
+#include <local/savestate.h>      // start_combination_from_savestates, record_savestate, load_next_savestate
 #include <local/display.h>
 #include <local/utils.h>
 #include <local/search_algorithm.h>
@@ -39,6 +41,8 @@ static void update_inputs(void);
 
 // main processed data memory
 static Board *board;
+static BoardDrawing *board_drawing; // drawing data of the board, allocated and freed with it (see display.h)
+static SolverContext *context;      // work memory of the checks, see solver_context.h
 
 // level data memory
 static LevelHints *level_hints;
@@ -61,6 +65,7 @@ static int previous_piece_priority_array[NB_OF_PIECES];
 // Variables that represent the internal state of the algorithm
 static int combination_idx;  // current combination index
 static int piece_selected;   // index of piece_priority_array
+static int similarity_depth; // number of starting pieces replayed from the previous combinations (see savestate.c)
 static int piece_idx;        // current piece index ( always set to := piece_priority_array[piece_selected])
 static Piece *current_piece; // current piece pointer
 
@@ -86,7 +91,9 @@ void InitSolverScreen(void)
 {
     level_hints = get_level_hints(level_num_selected);
     board = init_board(level_hints);
-    update_board_static_drawing(board);
+    board_drawing = init_board_drawing();
+    context = init_solver_context();
+    update_board_static_drawing(board, board_drawing);
 
     start_combinations = determine_start_combinations(board);
 
@@ -138,6 +145,25 @@ algo_beginning:
         // we don't have to update anything more
         return;
 
+    if (piece_selected < similarity_depth)
+    {
+        // end of play possibilities from the current savestate, replay the next one (see savestate.c)
+        if (load_next_savestate(&(context->savestates), board))
+        {
+            for (int depth = 0; depth < similarity_depth; depth++)
+                update_piece_all_drawing((board->piece_array) + piece_priority_array[depth], (board_drawing->piece_drawing_array) + piece_priority_array[depth], false, false);
+
+            is_backtrack_iteration = false;
+            piece_selected = similarity_depth - 1;
+            setup_next_piece();
+            if (piece_selected > current_max_depth)
+                current_max_depth = piece_selected;
+
+            return; // draw the replayed board
+        }
+        piece_selected = -1;
+    }
+
     if (piece_selected < 0)
     {
         // end of play possibilities for this combination, try to get next one
@@ -159,89 +185,28 @@ algo_beginning:
         // remove the piece from the board before trying to add it again
         undo_last_piece_adding(board);
 
-    // Incrementing current_piece positionning test variables in nested while loops
-    //      because we want to start / restart from previous position of the piece, and increment from it
-    //      but limit the incrementation
-    //      and only when the limit is reached, reset the state of the position variable
-    // It has the effect to work kind of like a python generator
-
-    while (current_piece->current_side_idx < current_piece->nb_of_sides)
+    // Try the next placements of current_piece (see placement.h), starting from its previous one
+    // It has the effect to work kind of like a python generator, as the piece remembers its last placement (see search_algorithm.c > "add_piece_to_next_valid_placement")
+    if (add_piece_to_next_valid_placement(board, context, piece_idx, playable_side_per_piece_idx_mask[piece_idx], is_backtrack_iteration, enable_slow_checks))
     {
-        // skip the current side if the side was set to be not playable in this combination
-        if (!playable_side_per_piece_idx_mask[piece_idx][current_piece->current_side_idx])
-        {
-            (current_piece->current_side_idx)++;
-            continue;
-        }
+        // All checks passed
+        // New valid board found !
+        is_backtrack_iteration = false;
+        record_savestate(&(context->savestates), piece_selected, current_piece->current_placement_idx);
 
-        while (current_piece->current_base_pos.i < BOARD_WIDTH)
-        {
-            while (current_piece->current_base_pos.j < BOARD_HEIGHT)
-            {
-                // don't even consider adding the piece at this position (i,j) if there's already a normal tile on the board
-                if (is_position_already_occupied(board, &(current_piece->current_base_pos)))
-                {
-                    (current_piece->current_base_pos.j)++;
-                    continue;
-                }
-
-                while (current_piece->current_rotation_state < current_piece->side_array[current_piece->current_side_idx].max_nb_of_rotations)
-                {
-                    // when we backtrack, we need to increment the previous piece overall position by 1
-                    // (if not, the piece will be added where it was just removed on the board)
-                    // we do it, by skipping 1 iteration in the innermost loop
-                    if (is_backtrack_iteration)
-                    {
-                        is_backtrack_iteration = false;
-                        (current_piece->current_rotation_state)++;
-                        continue;
-                    }
-
-                    // main tests here
-
-                    // pre-adding checks
-                    if (add_piece_to_board(board, piece_idx, current_piece->current_side_idx, current_piece->current_base_pos, current_piece->current_rotation_state) != 1)
-                    {
-                        // didn't pass, try again
-                        (current_piece->current_rotation_state)++;
-                        continue;
-                    }
-
-                    // post-adding checks
-                    if (run_all_checks(board, enable_slow_checks) != 1)
-                    {
-                        // remove the piece if the post-adding checks didn't pass, and try again
-                        undo_last_piece_adding(board);
-                        (current_piece->current_rotation_state)++;
-                        continue;
-                    }
-
-                    // All checks passed
-                    // New valid board found !
-
-                    update_piece_all_drawing(current_piece, false, false);
-                    valid_board_count++;
-
-                    // get next piece to play
-                    setup_next_piece();
-
-                    // record current_max_depth (after "setup_next_piece()" to have effectively piece_selected+1)
-                    // (+1, because piece_selected = 0 <=> depth = 1)
-                    if (piece_selected > current_max_depth)
-                        current_max_depth = piece_selected;
-
-                    return; // draw every frame that a new board is found
-                }
-                current_piece->current_rotation_state = 0;
-                (current_piece->current_base_pos.j)++;
-            }
-            current_piece->current_base_pos.j = 0;
-            (current_piece->current_base_pos.i)++;
-        }
-        current_piece->current_base_pos.i = 0;
-        (current_piece->current_side_idx)++;
+        update_piece_all_drawing(current_piece, (board_drawing->piece_drawing_array) + piece_idx, false, false);
+        valid_board_count++;
+
+        // get next piece to play
+        setup_next_piece();
+
+        // record current_max_depth (after "setup_next_piece()" to have effectively piece_selected+1)
+        // (+1, because piece_selected = 0 <=> depth = 1)
+        if (piece_selected > current_max_depth)
+            current_max_depth = piece_selected;
+
+        return; // draw every frame that a new board is found
     }
-    current_piece->current_side_idx = 0;
 
     // end of play possibilities for this piece, try to go to previous one (actual "backtrack")
     setup_previous_piece();
@@ -253,7 +218,7 @@ void DrawSolverScreen(void)
 
     ClearBackground(BLACK);
 
-    draw_board(board);
+    draw_board(board, board_drawing);
 
     // UI
     draw_piece_priority_array(piece_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
@@ -268,6 +233,8 @@ void DrawSolverScreen(void)
 }
 void UnloadSolverScreen(void)
 {
+    free(context);
+    free(board_drawing);
     free(board);
     free(level_hints);
 }
@@ -279,10 +246,7 @@ int FinishSolverScreen(void) { return finishScreen; }
 
 static void setup_next_combination(void)
 {
-    static int i;
-    // copy the current piece_priority_array up to the failure point
-    for (i = 0; i < current_max_depth + 1; i++)
-        previous_piece_priority_array[i] = piece_priority_array[i];
+    record_combination_failure(context, current_max_depth, piece_priority_array, previous_piece_priority_array);
 
     // skip the next combination until we know we are testing new things
     do
@@ -298,12 +262,16 @@ static void setup_next_combination(void)
         }
 
         load_combination_data(board, &start_combinations, combination_idx, piece_priority_array, &nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), piece_priority_array, board->nb_of_open_obligatory_point_tiles);
     } while (is_current_combination_skippable(current_max_depth, piece_priority_array, previous_piece_priority_array));
 
     current_max_depth = 0;
     is_backtrack_iteration = false;
     piece_selected = -1;
     setup_next_piece();
+
+    // the starting pieces in common with the previous combinations are replayed instead of being searched again
+    similarity_depth = start_combination_from_savestates(&(context->savestates), piece_priority_array, board->nb_of_open_obligatory_point_tiles);
 }
 
 static void setup_previous_piece(void)
@@ -100,12 +100,15 @@
 
 #include <raylib/raylib.h> // WindowShouldClose, CloseWindow, BeginDrawing, EndDrawing, ClearBackground, DrawFPS, SetTargetFPS
 
-#include <local/utils.h>       // Vector2_int, generate_next_combination and defines
-#include <local/piece_data.h>  // Tile, Side, Piece and defines
-#include <local/level_data.h>  // LevelHints, and defines
-#include <local/board.h>       // Board, helper functions and defines
-#include <local/check_board.h> // run_all_checks
-#include <local/display.h>     // tile_px_width, and other drawing functions
+#include <local/utils.h>          // Vector2_int, generate_next_combination, bitboard macros and defines
+#include <local/piece_data.h>     // Tile, Side, Piece and defines
+#include <local/level_data.h>     // LevelHints, and defines
+#include <local/board.h>          // Board, helper functions, level placements and defines
+#include <local/placement.h>      // placement_table, UNDEFINED_PLACEMENT_IDX
+#include <local/check_board.h>    // run_all_checks, print_disjoint_paths_check_stats, prune_playable_sides_with_tile_type_budget
+#include <local/solver_context.h> // SolverContext, init_solver_context
+#include <local/savestate.h>      // start_combination_from_savestates, record_savestate, load_next_savestate, print_savestate_stats
+#include <local/display.h>        // tile_px_width, and other drawing functions
 
 #include <local/search_algorithm.h>
 
@@ -129,30 +132,29 @@ StartCombinations determine_start_combinations(Board *board)
     }
 
     // temp variables
-    static int piece_idx;
-    static Piece *piece;
-    static bool piece_found;
+    int piece_idx;
+    Piece *piece;
+    bool piece_found;
 
     // main data variables
-    static int piece_idx_that_have_point_on_first_side_array[NB_OF_PIECES];
-    static int nb_of_point_pieces = 0;
+    int piece_idx_that_have_point_on_first_side_array[NB_OF_PIECES];
+    int nb_of_point_pieces = 0;
 
-    static int piece_idx_that_are_playable[NB_OF_PIECES];
-    static int nb_of_remaining_pieces;
+    int piece_idx_that_are_playable[NB_OF_PIECES];
+    int nb_of_remaining_pieces;
+
+    CombinationGenerator combination_generator = {0};
 
     // 1) Figure out the list of starting pieces (the one that have a point on their first side)
-    // do only this computation once, because it is the same for every level
-    if (nb_of_point_pieces == 0)
+    // (it is the same for every level, but it is cheap enough to not be cached somewhere shared between solvers)
+    // for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    for (piece_idx = NB_OF_PIECES - 1; piece_idx >= 0; piece_idx--)
     {
-        // for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
-        for (piece_idx = NB_OF_PIECES - 1; piece_idx >= 0; piece_idx--)
+        piece = (board->piece_array) + piece_idx;
+        if (piece->has_point_on_first_side)
         {
-            piece = (board->piece_array) + piece_idx;
-            if (piece->has_point_on_first_side)
-            {
-                piece_idx_that_have_point_on_first_side_array[nb_of_point_pieces] = piece_idx;
-                nb_of_point_pieces++;
-            }
+            piece_idx_that_have_point_on_first_side_array[nb_of_point_pieces] = piece_idx;
+            nb_of_point_pieces++;
         }
     }
 
@@ -179,7 +181,7 @@ StartCombinations determine_start_combinations(Board *board)
 
     // 3) Figure out the all the possible combinations from this list, depending on the nb of open points of the level
     start_combinations.nb_of_combinations = 0;
-    while (generate_next_combination(piece_idx_that_are_playable, nb_of_remaining_pieces, start_combinations.combination_array[start_combinations.nb_of_combinations], board->nb_of_open_obligatory_point_tiles))
+    while (generate_next_combination(&combination_generator, piece_idx_that_are_playable, nb_of_remaining_pieces, start_combinations.combination_array[start_combinations.nb_of_combinations], board->nb_of_open_obligatory_point_tiles))
         start_combinations.nb_of_combinations++;
 
     return start_combinations;
@@ -193,8 +195,8 @@ StartCombinations determine_start_combinations(Board *board)
 void load_combination_data(Board *board, StartCombinations *start_combinations, int combination_idx, int *piece_idx_priority_array, int *nb_of_playable_pieces, bool playable_side_per_piece_idx_mask[][MAX_NB_OF_SIDE_PER_PIECE])
 {
 
-    static int i, piece_idx;
-    static bool piece_found;
+    int i, piece_idx;
+    bool piece_found;
 
     *nb_of_playable_pieces = 0;
 
@@ -246,18 +248,21 @@ void load_combination_data(Board *board, StartCombinations *start_combinations,
         playable_side_per_piece_idx_mask[piece_idx][1] = true;
         playable_side_per_piece_idx_mask[piece_idx][2] = true;
     }
+
+    // the tile types of the level hints may already forbid some of these sides (see check_board.c)
+    prune_playable_sides_with_tile_type_budget(board, playable_side_per_piece_idx_mask);
 }
 
 // Function to only check if a position is already taken by a normal tile on the board
 bool is_position_already_occupied(Board *board, Vector2_int *base_pos)
 {
-    return (extract_normal_tile_at_pos(board, base_pos) != UNDEFINED_TILE);
+    return (board->normal_tile_mask & POS_TO_BIT_MASK(base_pos)) != 0;
 }
 
 bool is_current_combination_skippable(int current_max_depth, int piece_priority_array[NB_OF_PIECES], int previous_piece_priority_array[NB_OF_PIECES])
 {
 
-    static int i;
+    int i;
     // if the current piece has the exact same starting pieces that have failed before in the previous combination
     // skip it
 
@@ -271,21 +276,199 @@ bool is_current_combination_skippable(int current_max_depth, int piece_priority_
     return true;
 }
 
+// Function to add the piece to the board at a placement, if the pre-adding checks (see board.c) and the post-adding checks (see check_board.c) pass
+// Returns true if the piece has been added
+static bool try_placement(Board *board, SolverContext *context, int placement_idx, bool enable_slow_checks)
+{
+    // don't even consider adding the piece at this placement if there's already a normal tile on the board where the piece would be
+    if (board->normal_tile_mask & placement_table.placement_array[placement_idx].tile_mask)
+        return false;
+
+    // Board pre-adding, adding piece, and post-adding checks
+    if (add_placement_to_board(board, placement_idx) != 1)
+        return false;
+
+    // the board may have already been proven to have no solution (reached with other placements or in another combination, see transposition_table.c)
+    // (before the post-adding checks, as it is a lot cheaper)
+    if (is_board_known_as_dead(&(context->transposition_table), board->zobrist_key))
+    {
+        undo_last_piece_adding(board);
+        return false;
+    }
+
+    if (run_all_checks(board, context, enable_slow_checks) != 1)
+    {
+        undo_last_piece_adding(board);
+        return false;
+    }
+
+    return true;
+}
+
+// Function to add the piece to the board on its point side, at its first valid placement in [first_placement_idx, last_placement_idx[
+// The point of the side can only land on a point tile of the level hints (see board.c > "is_tile_matching_level_hints"), that isn't covered yet,
+// so instead of going through all the placements of the side, only the ones that have their point on these positions are tried (see placement.h, point position -> point placements index)
+// They are still tried in increasing placement index order (1 list per open point, merged on the fly), so that Piece::current_placement_idx stays the cursor of the piece
+// Returns true if the piece has been added
+static bool add_piece_at_open_points(Board *board, SolverContext *context, int piece_idx, int first_placement_idx, int last_placement_idx, bool enable_slow_checks)
+{
+    int cursor_array[BOARD_TOTAL_NB_TILES];
+    int last_cursor_array[BOARD_TOTAL_NB_TILES];
+    int nb_of_open_points = 0;
+    int bit_idx, point_idx, next_point_idx, placement_idx;
+    uint32_t open_point_tile_mask;
+
+    for (open_point_tile_mask = board->obligatory_point_tile_mask & ~(board->normal_tile_mask); open_point_tile_mask; open_point_tile_mask &= open_point_tile_mask - 1)
+    {
+        bit_idx = LOWEST_BIT_IDX(open_point_tile_mask);
+
+        cursor_array[nb_of_open_points] = placement_table.first_point_placement_idx_array[bit_idx][piece_idx];
+        last_cursor_array[nb_of_open_points] = placement_table.first_point_placement_idx_array[bit_idx][piece_idx + 1];
+        while (cursor_array[nb_of_open_points] < last_cursor_array[nb_of_open_points] && placement_table.point_placement_idx_array[cursor_array[nb_of_open_points]] < first_placement_idx)
+            cursor_array[nb_of_open_points]++;
+        nb_of_open_points++;
+    }
+
+    while (true)
+    {
+        // next placement among all the lists
+        next_point_idx = -1;
+        for (point_idx = 0; point_idx < nb_of_open_points; point_idx++)
+            if (cursor_array[point_idx] < last_cursor_array[point_idx] &&
+                (next_point_idx < 0 || placement_table.point_placement_idx_array[cursor_array[point_idx]] < placement_table.point_placement_idx_array[cursor_array[next_point_idx]]))
+                next_point_idx = point_idx;
+
+        if (next_point_idx < 0)
+            return false;
+
+        placement_idx = placement_table.point_placement_idx_array[cursor_array[next_point_idx]];
+        cursor_array[next_point_idx]++;
+
+        if (placement_idx >= last_placement_idx)
+            return false;
+
+        // the placement may not fit on the level hints board (see board.c > "load_level_placements")
+        if (!IS_LEVEL_PLACEMENT(board->level_placements, placement_idx))
+            continue;
+
+        if (try_placement(board, context, placement_idx, enable_slow_checks))
+            return true;
+    }
+}
+
+// Function to add the piece to the board at its first valid placement in [first_placement_idx, last_placement_idx[
+// "valid" meaning that the pre-adding checks (see board.c) and the post-adding checks (see check_board.c) pass
+// The placements are iterated in the same order as the old nested side / i / j / rotation loops, but the ones out of bounds don't even exist (see placement.h)
+// and only the ones that fit on the level hints board are gone through (see board.h > level placements)
+// Returns true if the piece has been added
+// Returns false if the piece has gone through all the placements of the range, its placement cursor is then reset for the next time
+bool add_piece_to_valid_placement_in_range(Board *board, SolverContext *context, int piece_idx, bool playable_side_mask[MAX_NB_OF_SIDE_PER_PIECE], int first_placement_idx, int last_placement_idx, bool enable_slow_checks)
+{
+    Piece *piece;
+    int side_idx, placement_idx, last_side_placement_idx, level_placement_pos;
+
+    piece = (board->piece_array) + piece_idx;
+    placement_idx = first_placement_idx;
+
+    for (side_idx = 0; side_idx < piece->nb_of_sides; side_idx++)
+    {
+        // only play forced sides (prievously determined by "load_combination_data")
+        if (!playable_side_mask[side_idx])
+            continue;
+
+        if (placement_idx < placement_table.first_placement_idx_array[piece_idx][side_idx])
+            placement_idx = placement_table.first_placement_idx_array[piece_idx][side_idx];
+
+        last_side_placement_idx = placement_table.first_placement_idx_array[piece_idx][side_idx + 1];
+        if (last_side_placement_idx > last_placement_idx)
+            last_side_placement_idx = last_placement_idx;
+
+        // the point side only goes through the placements that have their point on an open point
+        if (side_idx == 0 && piece->has_point_on_first_side)
+        {
+            if (placement_idx < last_side_placement_idx && add_piece_at_open_points(board, context, piece_idx, placement_idx, last_side_placement_idx, enable_slow_checks))
+                return true;
+            continue;
+        }
+
+        for (level_placement_pos = get_first_level_placement_pos(board, piece_idx, side_idx, placement_idx); level_placement_pos < board->level_placements->first_level_placement_idx_array[piece_idx][side_idx + 1]; level_placement_pos++)
+        {
+            placement_idx = board->level_placements->level_placement_idx_array[level_placement_pos];
+            if (placement_idx >= last_side_placement_idx)
+                break;
+
+            if (try_placement(board, context, placement_idx, enable_slow_checks))
+                return true;
+        }
+    }
+
+    piece->current_placement_idx = UNDEFINED_PLACEMENT_IDX;
+    return false;
+}
+
+// Function to add the piece to the board at its next valid placement, starting from its current placement (Piece::current_placement_idx)
+// see "add_piece_to_valid_placement_in_range"
+bool add_piece_to_next_valid_placement(Board *board, SolverContext *context, int piece_idx, bool playable_side_mask[MAX_NB_OF_SIDE_PER_PIECE], bool is_backtrack_iteration, bool enable_slow_checks)
+{
+    int first_placement_idx = board->piece_array[piece_idx].current_placement_idx;
+
+    // when we backtrack, we need to increment the previous piece placement by 1
+    // (if not, the piece will be added where it was just removed)
+    if (is_backtrack_iteration)
+        first_placement_idx++;
+
+    if (add_piece_to_valid_placement_in_range(board, context, piece_idx, playable_side_mask, first_placement_idx, placement_table.first_placement_idx_array[piece_idx][MAX_NB_OF_SIDE_PER_PIECE], enable_slow_checks))
+        return true;
+
+    // the piece has gone through all its placements on the current board (the ones before its cursor, before the cursor moved), and it must be placed
+    // => the current board has no solution
+    record_dead_board(&(context->transposition_table), board->zobrist_key);
+    return false;
+}
+
+// Function to record where the current combination failed, for "is_current_combination_skippable"
+void record_combination_failure(SolverContext *context, int current_max_depth, int piece_idx_priority_array[NB_OF_PIECES], int previous_piece_priority_array[NB_OF_PIECES])
+{
+    // if the transposition table has discarded boards in this combination, they haven't been explored as deep as they would have been
+    // so the failure point is unknown, and it can't be used to skip the next combination
+    if (has_transposition_table_cut_current_combination(&(context->transposition_table)))
+    {
+        previous_piece_priority_array[0] = -1;
+        return;
+    }
+
+    // copy the current piece_priority_array up to the failure point
+    for (int i = 0; i < current_max_depth + 1; i++)
+        previous_piece_priority_array[i] = piece_idx_priority_array[i];
+}
+
 // ----------------- Main algorithm mini sub routines ----------------------------------------------------------------------------
 
-static void setup_draw(Board *board)
+static void setup_draw(Board *board, BoardDrawing *board_drawing)
 {
     // Functions only needed because we display things
     setup_display((BOARD_WIDTH + 2) * tile_px_width, (BOARD_HEIGHT + 2) * tile_px_width);
     offset_px.i = 1 * tile_px_width; // padding to the left of the board to the left edge of the window
-    update_board_static_drawing(board);
+    update_board_static_drawing(board, board_drawing);
+}
+
+// Function to update the drawing of the pieces replayed from a savestate (see savestate.c)
+static void update_savestate_drawing(Board *board, BoardDrawing *board_drawing, int piece_idx_priority_array[NB_OF_PIECES], int similarity_depth)
+{
+    int piece_idx;
+
+    for (int depth = 0; depth < similarity_depth; depth++)
+    {
+        piece_idx = piece_idx_priority_array[depth];
+        update_piece_all_drawing((board->piece_array) + piece_idx, (board_drawing->piece_drawing_array) + piece_idx, false, false);
+    }
 }
 
-static void draw(Board *board, int level_num)
+static void draw(Board *board, BoardDrawing *board_drawing, int level_num)
 {
     BeginDrawing();
     ClearBackground(BLACK);
-    draw_board(board);
+    draw_board(board, board_drawing);
     draw_level_num(level_num);
     // DrawFPS(100, 10);
     EndDrawing();
@@ -300,13 +483,15 @@ void run_algorithm_with_display(int level_num, int FPS)
     // Main data variables init
     LevelHints *level_hints = get_level_hints(level_num);
     Board *board = init_board(level_hints);
+    SolverContext *context = init_solver_context();
 
     // Preprocessed constants of current setup
     StartCombinations start_combinations = determine_start_combinations(board);
 
     // Functions only needed because we display things
-    setup_draw(board);
-    static bool enable_slow_operations = false;
+    BoardDrawing *board_drawing = init_board_drawing();
+    setup_draw(board, board_drawing);
+    bool enable_slow_operations = false;
 
     // when set to 0, it's in fact unlimited FPS
     SetTargetFPS(FPS);
@@ -326,13 +511,13 @@ void run_algorithm_with_display(int level_num, int FPS)
 
     // variable to explore current piece_idx_priority_array
     // basically the depth at which the algorithm currently is, in the search tree
-    int piece_selected;
+    int piece_selected = 0;
+
+    // number of starting pieces of the current combination that are replayed from the previous ones (see savestate.c)
+    int similarity_depth;
 
-    // "add_piece_to_board" input parameters
+    // current piece to add to the board
     int piece_idx;
-    int side_idx;
-    Vector2_int base_pos;
-    int rotation_state;
 
     // variable to count valid boards and mesure logic performance, see this file description
     int valid_board_count = 0;
@@ -343,7 +528,6 @@ void run_algorithm_with_display(int level_num, int FPS)
     begin = clock();
 
     // convenience placeholder variables used in the loop
-    Piece *piece;
     bool backtrack_iteration = false;
     bool solved = false;
 
@@ -356,6 +540,7 @@ void run_algorithm_with_display(int level_num, int FPS)
         // other pieces are forced to play their sides without a point (as we can't add point tiles that don't belong to level hints, it is written in gamerules)
         // the algorithm can work without this last informations, but it is meant to skip obviously useless iterations
         load_combination_data(board, &start_combinations, combination_idx, piece_idx_priority_array, &nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
         if (is_current_combination_skippable(current_max_depth, piece_idx_priority_array, previous_piece_priority_array))
             continue;
@@ -364,22 +549,33 @@ void run_algorithm_with_display(int level_num, int FPS)
         piece_selected = 0;
         backtrack_iteration = false;
         current_max_depth = 0;
+        similarity_depth = start_combination_from_savestates(&(context->savestates), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
         // Loop to explore the current combination
         // The backtracking part is made by decrementing "piece_selected"
         while (true)
         {
-
-        next_piece:
+            // --- When everything has been explored from the current savestate, go on from the next one (with the starting pieces in common with the previous combinations)
+            if (piece_selected < similarity_depth)
+            {
+                if (load_next_savestate(&(context->savestates), board))
+                {
+                    update_savestate_drawing(board, board_drawing, piece_idx_priority_array, similarity_depth);
+                    piece_selected = similarity_depth;
+                    backtrack_iteration = false;
+                    if (board->nb_of_added_pieces > current_max_depth)
+                        current_max_depth = board->nb_of_added_pieces;
+                    continue;
+                }
+                piece_selected = -1;
+            }
 
             // --- Edges cases when piece_selected step out of valid "piece_idx_priority_array" indexes, in both directions
             if (piece_selected < 0)
             {
                 // case where the first piece used all its position possibilities, which means there are no solution with current combination
 
-                // copy the current piece_priority_array up to the failure point
-                for (int i = 0; i < current_max_depth + 1; i++)
-                    previous_piece_priority_array[i] = piece_idx_priority_array[i];
+                record_combination_failure(context, current_max_depth, piece_idx_priority_array, previous_piece_priority_array);
 
                 break;
             }
@@ -392,76 +588,37 @@ void run_algorithm_with_display(int level_num, int FPS)
             }
             // ---
 
+            if (WindowShouldClose())
+                goto quit_algorithm;
+
             // if we are currently backtracking, the piece needs to be removed
             // before being re-added
             if (backtrack_iteration)
                 undo_last_piece_adding(board);
 
-            // Part where the algorithm try all current piece position possibilities
-            // Starting from its previous position
-
-            // setup
+            // Part where the algorithm try all current piece placements (see placement.h)
+            // Starting from its previous one
             piece_idx = piece_idx_priority_array[piece_selected];
-            piece = (board->piece_array) + piece_idx;
 
-            // loop
-            for (side_idx = piece->current_side_idx; side_idx < piece->nb_of_sides; side_idx++)
+            if (add_piece_to_next_valid_placement(board, context, piece_idx, playable_side_per_piece_idx_mask[piece_idx], backtrack_iteration, enable_slow_operations))
             {
-                // only play forced sides (prievously determined by "load_combination_data")
-                if (!playable_side_per_piece_idx_mask[piece_idx][side_idx])
-                    continue;
-
-                for (base_pos.i = piece->current_base_pos.i; base_pos.i < BOARD_WIDTH; (base_pos.i)++)
-                {
-                    for (base_pos.j = piece->current_base_pos.j; base_pos.j < BOARD_HEIGHT; (base_pos.j)++)
-                    {
-                        // don't even consider adding the piece at this position if there's already a normal tile on the board
-                        if (is_position_already_occupied(board, &base_pos))
-                            continue;
-
-                        for (rotation_state = piece->current_rotation_state; rotation_state < piece->side_array[side_idx].max_nb_of_rotations; rotation_state++)
-                        {
-                            if (WindowShouldClose())
-                                goto quit_algorithm;
-
-                            // when we backtrack, we need to increment the previous piece overall position by 1
-                            // (if not, the piece will be added where it was just removed)
-                            // we do it, by skipping 1 iteration in the innermost loop
-                            if (backtrack_iteration)
-                            {
-                                backtrack_iteration = false;
-                                continue;
-                            }
-
-                            // Board pre-adding, adding piece, and post-adding checks
-                            if (add_piece_to_board(board, piece_idx, side_idx, base_pos, rotation_state) != 1)
-                                continue;
-                            if (run_all_checks(board, enable_slow_operations) != 1)
-                            {
-                                undo_last_piece_adding(board);
-                                continue;
-                            }
-                            // case where we successfully added a piece
-                            update_piece_all_drawing(piece, false, false);
-                            piece_selected++;
-                            valid_board_count++;
-                            if (enable_slow_operations)
-                                printf("new valid board found ! %d\n", valid_board_count);
-                            draw(board, level_num); // draw only when new board found to make everything faster
-
-                            // record current_max_depth
-                            if (board->nb_of_added_pieces > current_max_depth)
-                                current_max_depth = board->nb_of_added_pieces;
-
-                            goto next_piece;
-                        }
-                        piece->current_rotation_state = 0;
-                    }
-                    piece->current_base_pos.j = 0;
-                }
-                piece->current_base_pos.i = 0;
+                // case where we successfully added a piece
+                record_savestate(&(context->savestates), piece_selected, board->piece_array[piece_idx].current_placement_idx);
+                update_piece_all_drawing((board->piece_array) + piece_idx, (board_drawing->piece_drawing_array) + piece_idx, false, false);
+                piece_selected++;
+                valid_board_count++;
+                backtrack_iteration = false;
+                if (enable_slow_operations)
+                    printf("new valid board found ! %d\n", valid_board_count);
+                draw(board, board_drawing, level_num); // draw only when new board found to make everything faster
+
+                // record current_max_depth
+                if (board->nb_of_added_pieces > current_max_depth)
+                    current_max_depth = board->nb_of_added_pieces;
+
+                continue;
             }
-            piece->current_side_idx = 0;
+
             // the current piece has gone through all its possible positions
             // we need to backtrack (try to move the previous piece)
             piece_selected--;
@@ -481,10 +638,20 @@ end_loop:
         printf("No solution found...\n");
     printf("Time : %.3f seconds\n", time_spent);
     printf("Number of valid boards : %d\n", valid_board_count);
+    printf("Transposition table : ");
+    print_transposition_table_stats(&(context->transposition_table));
+    printf("\n");
+    printf("Savestates : ");
+    print_savestate_stats(&(context->savestates));
+    printf("\n");
+    print_disjoint_paths_check_stats(context);
+    printf("\n");
+    print_level_placement_stats(board);
+    printf("\n");
 
     // display last board state until user close the window
     while (!WindowShouldClose())
-        draw(board, level_num);
+        draw(board, board_drawing, level_num);
 
 #else
     printf("%3d : ", level_num);
@@ -492,12 +659,22 @@ end_loop:
         printf("solved -> ");
     else
         printf("unsolved -> ");
-    printf("%d | %d\n", valid_board_count, (int)(time_spent * 1000));
+    printf("%d | %d | ", valid_board_count, (int)(time_spent * 1000));
+    print_transposition_table_stats(&(context->transposition_table));
+    printf(" | ");
+    print_savestate_stats(&(context->savestates));
+    printf(" | ");
+    print_disjoint_paths_check_stats(context);
+    printf(" | ");
+    print_level_placement_stats(board);
+    printf("\n");
 
 #endif
 
 quit_algorithm:
     CloseWindow();
+    free(context);
+    free(board_drawing);
     free(board);
     free(level_hints);
 }
@@ -519,6 +696,7 @@ void run_algorithm_without_display(int level_num)
     // Main data variables init
     LevelHints *level_hints = get_level_hints(level_num);
     Board *board = init_board(level_hints);
+    SolverContext *context = init_solver_context();
 
     // Preprocessed constants of current setup
     StartCombinations start_combinations = determine_start_combinations(board);
@@ -536,13 +714,13 @@ void run_algorithm_without_display(int level_num)
 
     // variable to explore current piece_idx_priority_array
     // basically the depth at which the algorithm currently is, in the search tree
-    int piece_selected;
+    int piece_selected = 0;
+
+    // number of starting pieces of the current combination that are replayed from the previous ones (see savestate.c)
+    int similarity_depth;
 
-    // "add_piece_to_board" input parameters
+    // current piece to add to the board
     int piece_idx;
-    int side_idx;
-    Vector2_int base_pos;
-    int rotation_state;
 
     // variable to count valid boards and mesure logic performance, see this file description
     int valid_board_count = 0;
@@ -553,7 +731,6 @@ void run_algorithm_without_display(int level_num)
     begin = clock();
 
     // convenience placeholder variables used in the loop
-    Piece *piece;
     bool backtrack_iteration = false;
     bool solved = false;
 
@@ -566,6 +743,7 @@ void run_algorithm_without_display(int level_num)
         // other pieces are forced to play their sides without a point (as we can't add point tiles that don't belong to level hints, it is written in gamerules)
         // the algorithm can work without this last informations, but it is meant to skip obviously useless iterations
         load_combination_data(board, &start_combinations, combination_idx, piece_idx_priority_array, &nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
         if (is_current_combination_skippable(current_max_depth, piece_idx_priority_array, previous_piece_priority_array))
             continue;
@@ -574,22 +752,32 @@ void run_algorithm_without_display(int level_num)
         piece_selected = 0;
         backtrack_iteration = false;
         current_max_depth = 0;
+        similarity_depth = start_combination_from_savestates(&(context->savestates), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
         // Loop to explore the current combination
         // The backtracking part is made by decrementing "piece_selected"
         while (true)
         {
-
-        next_piece:
+            // --- When everything has been explored from the current savestate, go on from the next one (with the starting pieces in common with the previous combinations)
+            if (piece_selected < similarity_depth)
+            {
+                if (load_next_savestate(&(context->savestates), board))
+                {
+                    piece_selected = similarity_depth;
+                    backtrack_iteration = false;
+                    if (board->nb_of_added_pieces > current_max_depth)
+                        current_max_depth = board->nb_of_added_pieces;
+                    continue;
+                }
+                piece_selected = -1;
+            }
 
             // --- Edges cases when piece_selected step out of valid "piece_idx_priority_array" indexes, in both directions
             if (piece_selected < 0)
             {
                 // case where the first piece used all its position possibilities, which means there are no solution with current combination
 
-                // copy the current piece_priority_array up to the failure point
-                for (int i = 0; i < current_max_depth + 1; i++)
-                    previous_piece_priority_array[i] = piece_idx_priority_array[i];
+                record_combination_failure(context, current_max_depth, piece_idx_priority_array, previous_piece_priority_array);
 
                 break;
             }
@@ -607,66 +795,26 @@ void run_algorithm_without_display(int level_num)
             if (backtrack_iteration)
                 undo_last_piece_adding(board);
 
-            // Part where the algorithm try all current piece position possibilities
-            // Starting from its previous position
-
-            // setup
+            // Part where the algorithm try all current piece placements (see placement.h)
+            // Starting from its previous one
             piece_idx = piece_idx_priority_array[piece_selected];
-            piece = (board->piece_array) + piece_idx;
 
-            // loop
-            for (side_idx = piece->current_side_idx; side_idx < piece->nb_of_sides; side_idx++)
+            if (add_piece_to_next_valid_placement(board, context, piece_idx, playable_side_per_piece_idx_mask[piece_idx], backtrack_iteration, false))
             {
-                // only play forced sides (prievously determined by "load_combination_data")
-                if (!playable_side_per_piece_idx_mask[piece_idx][side_idx])
-                    continue;
-
-                for (base_pos.i = piece->current_base_pos.i; base_pos.i < BOARD_WIDTH; (base_pos.i)++)
-                {
-                    for (base_pos.j = piece->current_base_pos.j; base_pos.j < BOARD_HEIGHT; (base_pos.j)++)
-                    {
-                        // don't even consider adding the piece at this position if there's already a normal tile on the board
-                        if (is_position_already_occupied(board, &base_pos))
-                            continue;
-
-                        for (rotation_state = piece->current_rotation_state; rotation_state < piece->side_array[side_idx].max_nb_of_rotations; rotation_state++)
-                        {
-
-                            // when we backtrack, we need to increment the previous piece overall position by 1
-                            // (if not, the piece will be added where it was just removed)
-                            // we do it, by skipping 1 iteration in the innermost loop
-                            if (backtrack_iteration)
-                            {
-                                backtrack_iteration = false;
-                                continue;
-                            }
-
-                            // Board pre-adding, adding piece, and post-adding checks
-                            if (add_piece_to_board(board, piece_idx, side_idx, base_pos, rotation_state) != 1)
-                                continue;
-                            if (run_all_checks(board, false) != 1)
-                            {
-                                undo_last_piece_adding(board);
-                                continue;
-                            }
-                            // case where we successfully added a piece
-                            piece_selected++;
-                            valid_board_count++;
-                            // printf("new valid board found ! %d\n", valid_board_count);
-
-                            // record current_max_depth
-                            if (board->nb_of_added_pieces > current_max_depth)
-                                current_max_depth = board->nb_of_added_pieces;
-
-                            goto next_piece;
-                        }
-                        piece->current_rotation_state = 0;
-                    }
-                    piece->current_base_pos.j = 0;
-                }
-                piece->current_base_pos.i = 0;
+                // case where we successfully added a piece
+                record_savestate(&(context->savestates), piece_selected, board->piece_array[piece_idx].current_placement_idx);
+                piece_selected++;
+                valid_board_count++;
+                backtrack_iteration = false;
+                // printf("new valid board found ! %d\n", valid_board_count);
+
+                // record current_max_depth
+                if (board->nb_of_added_pieces > current_max_depth)
+                    current_max_depth = board->nb_of_added_pieces;
+
+                continue;
             }
-            piece->current_side_idx = 0;
+
             // the current piece has gone through all its possible positions
             // we need to backtrack (try to move the previous piece)
             piece_selected--;
@@ -686,15 +834,27 @@ end_loop:
         printf("No solution found...\n");
     printf("Time : %.3f seconds\n", time_spent);
     printf("Number of valid boards : %d\n", valid_board_count);
+    printf("Transposition table : ");
+    print_transposition_table_stats(&(context->transposition_table));
+    printf("\n");
+    printf("Savestates : ");
+    print_savestate_stats(&(context->savestates));
+    printf("\n");
+    print_disjoint_paths_check_stats(context);
+    printf("\n");
+    print_level_placement_stats(board);
+    printf("\n");
 
     // Display only the last board state
-    setup_draw(board);
+    BoardDrawing *board_drawing = init_board_drawing();
+    setup_draw(board, board_drawing);
 
     // display last board state until user close the window
     while (!WindowShouldClose())
-        draw(board, level_num);
+        draw(board, board_drawing, level_num);
 
     CloseWindow();
+    free(board_drawing);
 
 #else
     printf("%3d : ", level_num);
@@ -702,10 +862,19 @@ end_loop:
         printf("solved -> ");
     else
         printf("unsolved -> ");
-    printf("%d | %d\n", valid_board_count, (int)(time_spent * 1000));
+    printf("%d | %d | ", valid_board_count, (int)(time_spent * 1000));
+    print_transposition_table_stats(&(context->transposition_table));
+    printf(" | ");
+    print_savestate_stats(&(context->savestates));
+    printf(" | ");
+    print_disjoint_paths_check_stats(context);
+    printf(" | ");
+    print_level_placement_stats(board);
+    printf("\n");
 
 #endif
 
+    free(context);
     free(board);
     free(level_hints);
 }
@@ -722,18 +891,18 @@ end_loop:
 // functions that are a draft version of what we display in screen_solver.c and screen_game.c
 // (more interface displayed)
 
-static void setup_extra_draw(Board *board)
+static void setup_extra_draw(Board *board, BoardDrawing *board_drawing)
 {
     // Functions only needed because we display things
     setup_display((BOARD_WIDTH + 9) * tile_px_width, (BOARD_HEIGHT + 5) * tile_px_width);
-    update_board_static_drawing(board);
+    update_board_static_drawing(board, board_drawing);
 }
 
-static void extra_draw(Board *board, int level_num, int piece_idx_priority_array[NB_OF_PIECES], int piece_selected, int nb_of_playable_pieces, bool playable_side_per_piece_idx_mask[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE])
+static void extra_draw(Board *board, BoardDrawing *board_drawing, int level_num, int piece_idx_priority_array[NB_OF_PIECES], int piece_selected, int nb_of_playable_pieces, bool playable_side_per_piece_idx_mask[NB_OF_PIECES][MAX_NB_OF_SIDE_PER_PIECE])
 {
     BeginDrawing();
     ClearBackground(BLACK);
-    draw_board(board);
+    draw_board(board, board_drawing);
     draw_piece_priority_array(piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
     draw_level_num(level_num);
     EndDrawing();
@@ -745,14 +914,16 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
     // Main data variables init
     LevelHints *level_hints = get_level_hints(level_num);
     Board *board = init_board(level_hints);
+    SolverContext *context = init_solver_context();
 
     // Preprocessed constants of current setup
     StartCombinations start_combinations = determine_start_combinations(board);
 
     // Functions only needed because we display things
-    setup_extra_draw(board);
+    BoardDrawing *board_drawing = init_board_drawing();
+    setup_extra_draw(board, board_drawing);
 
-    static bool enable_slow_operations = false;
+    bool enable_slow_operations = false;
 
     // when set to 0, it's in fact unlimited FPS
     SetTargetFPS(FPS);
@@ -772,13 +943,13 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
 
     // variable to explore current piece_idx_priority_array
     // basically the depth at which the algorithm currently is, in the search tree
-    int piece_selected;
+    int piece_selected = 0;
 
-    // "add_piece_to_board" input parameters
+    // number of starting pieces of the current combination that are replayed from the previous ones (see savestate.c)
+    int similarity_depth;
+
+    // current piece to add to the board
     int piece_idx;
-    int side_idx;
-    Vector2_int base_pos;
-    int rotation_state;
 
     // variable to count valid boards and mesure logic performance, see this file description
     int valid_board_count = 0;
@@ -789,7 +960,6 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
     begin = clock();
 
     // convenience placeholder variables used in the loop
-    Piece *piece;
     bool backtrack_iteration = false;
     bool solved = false;
 
@@ -802,6 +972,7 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
         // other pieces are forced to play their sides without a point (as we can't add point tiles that don't belong to level hints, it is written in gamerules)
         // the algorithm can work without this last informations, but it is meant to skip obviously useless iterations
         load_combination_data(board, &start_combinations, combination_idx, piece_idx_priority_array, &nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        set_transposition_table_combination(&(context->transposition_table), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
         if (is_current_combination_skippable(current_max_depth, piece_idx_priority_array, previous_piece_priority_array))
             continue;
@@ -810,24 +981,35 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
         piece_selected = 0;
         backtrack_iteration = false;
         current_max_depth = 0;
+        similarity_depth = start_combination_from_savestates(&(context->savestates), piece_idx_priority_array, board->nb_of_open_obligatory_point_tiles);
 
-        extra_draw(board, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        extra_draw(board, board_drawing, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
 
         // Loop to explore the current combination
         // The backtracking part is made by decrementing "piece_selected"
         while (true)
         {
-
-        next_piece:
+            // --- When everything has been explored from the current savestate, go on from the next one (with the starting pieces in common with the previous combinations)
+            if (piece_selected < similarity_depth)
+            {
+                if (load_next_savestate(&(context->savestates), board))
+                {
+                    update_savestate_drawing(board, board_drawing, piece_idx_priority_array, similarity_depth);
+                    piece_selected = similarity_depth;
+                    backtrack_iteration = false;
+                    if (board->nb_of_added_pieces > current_max_depth)
+                        current_max_depth = board->nb_of_added_pieces;
+                    continue;
+                }
+                piece_selected = -1;
+            }
 
             // --- Edges cases when piece_selected step out of valid "piece_idx_priority_array" indexes, in both directions
             if (piece_selected < 0)
             {
                 // case where the first piece used all its position possibilities, which means there are no solution with current combination
 
-                // copy the current piece_priority_array up to the failure point
-                for (int i = 0; i < current_max_depth + 1; i++)
-                    previous_piece_priority_array[i] = piece_idx_priority_array[i];
+                record_combination_failure(context, current_max_depth, piece_idx_priority_array, previous_piece_priority_array);
 
                 break;
             }
@@ -840,76 +1022,37 @@ void run_algorithm_with_extra_display(int level_num, int FPS)
             }
             // ---
 
+            if (WindowShouldClose())
+                goto quit_algorithm;
+
             // if we are currently backtracking, the piece needs to be removed
             // before being re-added
             if (backtrack_iteration)
                 undo_last_piece_adding(board);
 
-            // Part where the algorithm try all current piece position possibilities
-            // Starting from its previous position
-
-            // setup
+            // Part where the algorithm try all current piece placements (see placement.h)
+            // Starting from its previous one
             piece_idx = piece_idx_priority_array[piece_selected];
-            piece = (board->piece_array) + piece_idx;
 
-            // loop
-            for (side_idx = piece->current_side_idx; side_idx < piece->nb_of_sides; side_idx++)
+            if (add_piece_to_next_valid_placement(board, context, piece_idx, playable_side_per_piece_idx_mask[piece_idx], backtrack_iteration, enable_slow_operations))
             {
-                // only play forced sides (prievously determined by "load_combination_data")
-                if (!playable_side_per_piece_idx_mask[piece_idx][side_idx])
-                    continue;
-
-                for (base_pos.i = piece->current_base_pos.i; base_pos.i < BOARD_WIDTH; (base_pos.i)++)
-                {
-                    for (base_pos.j = piece->current_base_pos.j; base_pos.j < BOARD_HEIGHT; (base_pos.j)++)
-                    {
-                        // don't even consider adding the piece at this position if there's already a normal tile on the board
-                        if (is_position_already_occupied(board, &base_pos))
-                            continue;
-
-                        for (rotation_state = piece->current_rotation_state; rotation_state < piece->side_array[side_idx].max_nb_of_rotations; rotation_state++)
-                        {
-                            if (WindowShouldClose())
-                                goto quit_algorithm;
-
-                            // when we backtrack, we need to increment the previous piece overall position by 1
-                            // (if not, the piece will be added where it was just removed)
-                            // we do it, by skipping 1 iteration in the innermost loop
-                            if (backtrack_iteration)
-                            {
-                                backtrack_iteration = false;
-                                continue;
-                            }
-
-                            // Board pre-adding, adding piece, and post-adding checks
-                            if (add_piece_to_board(board, piece_idx, side_idx, base_pos, rotation_state) != 1)
-                                continue;
-                            if (run_all_checks(board, enable_slow_operations) != 1)
-                            {
-                                undo_last_piece_adding(board);
-                                continue;
-                            }
-                            // case where we successfully added a piece
-                            update_piece_all_drawing(piece, false, false);
-                            piece_selected++;
-                            valid_board_count++;
-                            if (enable_slow_operations)
-                                printf("new valid board found ! %d\n", valid_board_count);
-                            extra_draw(board, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
-
-                            // record current_max_depth
-                            if (board->nb_of_added_pieces > current_max_depth)
-                                current_max_depth = board->nb_of_added_pieces; // @todo don't forget to change "screen_solver" here too
-
-                            goto next_piece;
-                        }
-                        piece->current_rotation_state = 0;
-                    }
-                    piece->current_base_pos.j = 0;
-                }
-                piece->current_base_pos.i = 0;
+                // case where we successfully added a piece
+                record_savestate(&(context->savestates), piece_selected, board->piece_array[piece_idx].current_placement_idx);
+                update_piece_all_drawing((board->piece_array) + piece_idx, (board_drawing->piece_drawing_array) + piece_idx, false, false);
+                piece_selected++;
+                valid_board_count++;
+                backtrack_iteration = false;
+                if (enable_slow_operations)
+                    printf("new valid board found ! %d\n", valid_board_count);
+                extra_draw(board, board_drawing, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+
+                // record current_max_depth
+                if (board->nb_of_added_pieces > current_max_depth)
+                    current_max_depth = board->nb_of_added_pieces; // @todo don't forget to change "screen_solver" here too
+
+                continue;
             }
-            piece->current_side_idx = 0;
+
             // the current piece has gone through all its possible positions
             // we need to backtrack (try to move the previous piece)
             piece_selected--;
@@ -927,13 +1070,25 @@ end_loop:
         printf("No solution found...\n");
     printf("Time : %.3f seconds\n", time_spent);
     printf("Number of valid boards : %d\n", valid_board_count);
+    printf("Transposition table : ");
+    print_transposition_table_stats(&(context->transposition_table));
+    printf("\n");
+    printf("Savestates : ");
+    print_savestate_stats(&(context->savestates));
+    printf("\n");
+    print_disjoint_paths_check_stats(context);
+    printf("\n");
+    print_level_placement_stats(board);
+    printf("\n");
 
     // display last board state until user close the window
     while (!WindowShouldClose())
-        extra_draw(board, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
+        extra_draw(board, board_drawing, level_num, piece_idx_priority_array, piece_selected, nb_of_playable_pieces, playable_side_per_piece_idx_mask);
 
 quit_algorithm:
     CloseWindow();
+    free(context);
+    free(board_drawing);
     free(board);
     free(level_hints);
 }
\ No newline at end of file
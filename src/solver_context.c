@@ -0,0 +1,32 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file solver_context.c
+ * @see solver_context.h
+ */
+
+#include <stdbool.h>
+#include <stdlib.h> // calloc
+
+#include <local/check_board.h> // FIRST_DISJOINT_PATHS_CHECK_DEPTH, LAST_DISJOINT_PATHS_CHECK_DEPTH
+
+#include <local/solver_context.h>
+
+// Settings of the checks that the solver uses when nothing else is asked (flood fill dead end check, disjoint paths check at its measured depths)
+CheckSettings get_default_check_settings(void)
+{
+    return (CheckSettings){
+        .use_astar_dead_end_check = false,
+        .first_disjoint_paths_check_depth = FIRST_DISJOINT_PATHS_CHECK_DEPTH,
+        .last_disjoint_paths_check_depth = LAST_DISJOINT_PATHS_CHECK_DEPTH,
+    };
+}
+
+// Constructor of a solver context (free it with free(), like boards), with the default check settings
+SolverContext *init_solver_context(void)
+{
+    SolverContext *context = calloc(1, sizeof(SolverContext));
+    context->check_settings = get_default_check_settings();
+    return context;
+}
@@ -0,0 +1,150 @@
+/**
+ * @author Adrien Duqué (@adrienduque)
+ * Original Github repository : https://github.com/adrienduque/IQ_circuit_solver
+ *
+ * @file transposition_table.c
+ *
+ * Memory of the board states that the search algorithm has already proven to have no solution
+ *
+ * Explanation :
+ *
+ *      The search algorithm can reach the same board state through different placements of the same pieces, or in another combination,
+ *      and it would explore everything under it from scratch again.
+ *
+ *      1) Key of a board (Zobrist hashing)
+ *
+ *      What matters for the rest of the search is not where each piece is, but what the next pieces will have to deal with :
+ *          - the connections of the normal tile at each position (occupancy included, and the paths, that are followed by the loop and dead end checks)
+ *          - the missing connection tiles that are not filled yet (double missing connection tiles included)
+ *          - the remaining pieces, and which of their sides they can play
+ *
+ *      Each of these elements has a random 64 bits key, and the key of a board is the XOR of the keys of all its elements.
+ *      XOR is its own inverse, so the key is kept up to date in "add_placement_to_board" and "undo_last_piece_adding" (see board.c) with a few XOR.
+ *      (the normal tiles and added piece part of each placement is precomputed, see placement.h)
+ *
+ *      The playable sides of the remaining pieces depend on the combination (see search_algorithm.c > "load_combination_data") :
+ *      point pieces of the combination can only play their point side, all other point pieces can't.
+ *      So the transposition table holds the key of the combination pieces, and placing a combination piece on its point side XOR its key again (it cancels out).
+ *      => only the remaining combination pieces are part of the final key.
+ *
+ *      2) Recording
+ *
+ *      When a piece has gone through all its possible placements on a board, this board has no solution (all the following pieces need to be placed too).
+ *      The key is then recorded, and later, the board states with this key are discarded as soon as they are reached.
+ *
+ *      The table has a fixed size, and a key simply replaces the previous one of its slot.
+ *      Different board states with the same key are possible, but with 64 bits keys, it would be really unlucky.
+ */
+
+#include <stdbool.h>
+#include <stdint.h> // uint64_t
+#include <stdio.h>  // printf
+
+#include <local/utils.h>      // defines
+#include <local/piece_data.h> // defines
+
+#include <local/transposition_table.h>
+
+ZobristKeys zobrist_keys;
+
+static bool are_zobrist_keys_loaded = false;
+
+// -------------- Helper functions ---------------------------------------------------------------------------------
+
+// xorshift64* pseudo random generator, with a fixed seed so that the keys are the same from one run to another
+static uint64_t get_next_random_key(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+static uint64_t get_slot_idx(uint64_t board_key)
+{
+    return board_key & (TRANSPOSITION_TABLE_SIZE - 1);
+}
+
+// -------------- Main functions ---------------------------------------------------------------------------------
+
+// Function to generate the random keys, only the first call does something (it is called when the placement table is loaded)
+void load_zobrist_keys(void)
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    int bit_idx, i;
+
+    if (are_zobrist_keys_loaded)
+        return;
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        for (i = 0; i < (1 << NB_OF_DIRECTIONS); i++)
+            zobrist_keys.normal_tile_key_array[bit_idx][i] = get_next_random_key(&state);
+        for (i = 0; i < NB_OF_DIRECTIONS; i++)
+            zobrist_keys.missing_connection_tile_key_array[bit_idx][i] = get_next_random_key(&state);
+    }
+
+    for (i = 0; i < NB_OF_PIECES; i++)
+    {
+        zobrist_keys.added_piece_key_array[i] = get_next_random_key(&state);
+        zobrist_keys.combination_piece_key_array[i] = get_next_random_key(&state);
+    }
+
+    are_zobrist_keys_loaded = true;
+}
+
+// Function to call each time the search algorithm starts a new combination, the first "nb_of_combination_pieces" of "piece_idx_priority_array" are the combination pieces
+void set_transposition_table_combination(TranspositionTable *transposition_table, int piece_idx_priority_array[NB_OF_PIECES], int nb_of_combination_pieces)
+{
+    transposition_table->combination_generation++;
+    transposition_table->nb_of_hits_from_other_combinations_at_combination_start = transposition_table->nb_of_hits_from_other_combinations;
+
+    transposition_table->combination_key = 0;
+    for (int i = 0; i < nb_of_combination_pieces; i++)
+        transposition_table->combination_key ^= zobrist_keys.combination_piece_key_array[piece_idx_priority_array[i]];
+}
+
+// Returns true if some boards have been discarded since the current combination started, because of what was recorded in other combinations
+// (boards recorded in the current combination have already been explored in it)
+bool has_transposition_table_cut_current_combination(TranspositionTable *transposition_table)
+{
+    return transposition_table->nb_of_hits_from_other_combinations != transposition_table->nb_of_hits_from_other_combinations_at_combination_start;
+}
+
+// Returns true if the board (see Board::zobrist_key) has been recorded as having no solution
+bool is_board_known_as_dead(TranspositionTable *transposition_table, uint64_t board_key)
+{
+    uint64_t key = board_key ^ transposition_table->combination_key;
+    TranspositionTableEntry *entry = (transposition_table->entry_array) + get_slot_idx(key);
+
+    transposition_table->nb_of_probes++;
+    if (key == EMPTY_TRANSPOSITION_TABLE_SLOT || entry->dead_board_key != key)
+        return false;
+
+    transposition_table->nb_of_hits++;
+    if (entry->combination_generation != transposition_table->combination_generation)
+        transposition_table->nb_of_hits_from_other_combinations++;
+    return true;
+}
+
+// Function to record that the board (see Board::zobrist_key) has no solution
+void record_dead_board(TranspositionTable *transposition_table, uint64_t board_key)
+{
+    uint64_t key = board_key ^ transposition_table->combination_key;
+    TranspositionTableEntry *entry = (transposition_table->entry_array) + get_slot_idx(key);
+
+    entry->dead_board_key = key;
+    entry->combination_generation = transposition_table->combination_generation;
+    transposition_table->nb_of_records++;
+}
+
+// Function to print the hit rate and the memory used by the transposition table, on the current line
+void print_transposition_table_stats(TranspositionTable *transposition_table)
+{
+    double hit_rate = 0;
+
+    if (transposition_table->nb_of_probes != 0)
+        hit_rate = 100.0 * transposition_table->nb_of_hits / transposition_table->nb_of_probes;
+
+    printf("tt %lld hits / %lld probes (%.1f%%), %lld records, %d KB", transposition_table->nb_of_hits, transposition_table->nb_of_probes, hit_rate, transposition_table->nb_of_records, (int)(sizeof(transposition_table->entry_array) / 1024));
+}
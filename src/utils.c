@@ -102,7 +102,7 @@ static Matrix2_2_int rotation_mat_array[] = {
 
 static void matrix_mul(Vector2_int *pos, const Matrix2_2_int *matrix)
 {
-    static int temp_new_i, temp_new_j;
+    int temp_new_i, temp_new_j;
     temp_new_i = pos->i * matrix->m0 + pos->j * matrix->m1;
     temp_new_j = pos->i * matrix->m2 + pos->j * matrix->m3;
 
@@ -161,45 +161,65 @@ int manhattan_dist(const Vector2_int *pos1, const Vector2_int *pos2)
     return abs((pos1->i) - (pos2->i)) + abs((pos1->j) - (pos2->j));
 }
 
+// -------------------------------------- Bitboard stuff ------------------------------------
+
+// Function to flood fill from the tiles of "seed_mask", through the tiles of "free_tile_mask" (see utils.h > bitboard stuff)
+// Returns the mask of all the tiles of "free_tile_mask" that are connected to the seed (the seed tiles themselves are included if they are free)
+// (1 step grows the region by 1 tile in every direction at once, so it takes at most BOARD_TOTAL_NB_TILES steps, and a lot less on real boards)
+uint32_t get_region_mask(uint32_t seed_mask, uint32_t free_tile_mask)
+{
+    uint32_t region_mask = seed_mask & free_tile_mask;
+    uint32_t previous_region_mask = 0;
+
+    while (region_mask != previous_region_mask)
+    {
+        previous_region_mask = region_mask;
+        region_mask = (region_mask | NEIGHBOUR_MASK(region_mask)) & free_tile_mask;
+    }
+
+    return region_mask;
+}
+
 // -------------------------------------- Math needed for main search algorithm ------------------------------------
 
 // function to generate all r-combinations of input array (which is necessary an array of ints here)
 // (max r = 10 in this implementation)
 // the result is stored in next_combination_placeholder by reference
 // the function needs to be called repeatedly for all combinations to be yield
+// the iteration state is kept in the generator (see utils.h > CombinationGenerator), which must be zero-initialized before the first call
+// and is reset when the function returns 0, so it can be reused for a new generation
 // function derived from : https://scvalex.net/posts/cp5/
-int generate_next_combination(const int *input_int_array, int input_array_length, int *next_combination_placeholder, int r)
+int generate_next_combination(CombinationGenerator *generator, const int *input_int_array, int input_array_length, int *next_combination_placeholder, int r)
 {
     if (r == 0)
         return 0;
 
-    static int i;
-    static int n;
-    static int comb[10];
-    static bool is_init = false;
+    int i;
+    int *comb = generator->comb;
 
-    if (!is_init)
+    if (!generator->is_init)
     {
-        n = input_array_length;
+        generator->n = input_array_length;
         for (i = 0; i < r; i++)
             comb[i] = i;
-        is_init = true;
+        generator->is_init = true;
     }
     else
     {
 
         i = r - 1;
         comb[i]++;
-        while ((i >= 0) && (comb[i] >= n - r + 1 + i))
+        // (i > 0, and not i >= 0, to not increment comb[-1] when the last combination overflows, comb[0] > n - r is enough to detect it below)
+        while ((i > 0) && (comb[i] >= generator->n - r + 1 + i))
         {
             i--;
             comb[i]++;
         }
 
-        if (comb[0] > n - r)
+        if (comb[0] > generator->n - r)
         {
             // end of current generation, we reach the end of possible combinations
-            is_init = false;
+            generator->is_init = false;
             return 0;
         }
 
@@ -219,7 +239,7 @@ char assets_folder_relative_path[30];
 // I prefer finding the assets directory dynamically
 void find_asset_folder_relative_path(void)
 {
-    static const char *path_to_test[] = {"assets", "../assets", "../../assets"};
+    const char *path_to_test[] = {"assets", "../assets", "../../assets"};
     int idx = -1;
     Image icon;
 
@@ -6,13 +6,14 @@
  * This is not really a proper "unit testing" file where tests are automated with assertions
  */
 
-#include <local/utils.h>       // Vector2_int, helper functions and defines
-#include <local/piece_data.h>  // Tile, Side, Piece, load_piece_array, and defines
-#include <local/piece.h>       // blit_piece_main_data, update_piece_border_tiles
-#include <local/board.h>       // Board, helper functions and defines
-#include <local/check_board.h> // run_all_checks and defines
-#include <local/level_data.h>  // LevelHints
-#include <local/display.h>
+#include <local/utils.h>          // Vector2_int, helper functions and defines
+#include <local/piece_data.h>     // Tile, Side, Piece, load_piece_array, and defines
+#include <local/piece.h>          // blit_piece_main_data
+#include <local/board.h>          // Board, helper functions and defines
+#include <local/check_board.h>    // run_all_checks and defines
+#include <local/solver_context.h> // SolverContext, init_solver_context
+#include <local/level_data.h>     // LevelHints
+#include <local/display.h>        // update_piece_all_drawing, draw_piece, get_piece_name
 #include <minunit.h>
 #include <raylib/raylib.h>
 #include <stdbool.h>
@@ -24,7 +25,7 @@ int tests_run = 0;
 // function used in piece_data_display_test()
 static void print_piece_pos_infos(Piece *piece)
 {
-    printf("Piece : %s | side %d at (pos : {%d,%d} | rota : %d) \n", piece->name, piece->current_side_idx, piece->current_base_pos.i, piece->current_base_pos.j, piece->current_rotation_state);
+    printf("Piece : %s | side %d at (pos : {%d,%d} | rota : %d) \n", get_piece_name(piece->piece_idx), piece->current_side_idx, piece->current_base_pos.i, piece->current_base_pos.j, piece->current_rotation_state);
 }
 
 // helper function for piece_data_display_test
@@ -77,13 +78,13 @@ char *piece_data_display_test()
     bool show_missing_connection_tiles = true;
     bool show_border_tiles = true;
 
-    // piece main live data holder
+    // piece main live data holder, and its drawing data
     Piece *piece = piece_array + piece_idx;
+    PieceDrawing piece_drawing_array[NB_OF_PIECES];
 
     // initialize piece first state
     blit_piece_main_data(piece, side_idx, base_pos, rotation_state);
-    update_piece_border_tiles(piece);
-    update_piece_all_drawing(piece, show_missing_connection_tiles, show_border_tiles);
+    update_piece_all_drawing(piece, piece_drawing_array + piece_idx, show_missing_connection_tiles, show_border_tiles);
 
     printf("Now entering interactive piece display test.\n\n");
     print_piece_pos_infos(piece);
@@ -128,8 +129,7 @@ char *piece_data_display_test()
         {
             // Update all cached data only when necessary
             blit_piece_main_data(piece, side_idx, base_pos, rotation_state);
-            update_piece_border_tiles(piece);
-            update_piece_all_drawing(piece, show_missing_connection_tiles, show_border_tiles);
+            update_piece_all_drawing(piece, piece_drawing_array + piece_idx, show_missing_connection_tiles, show_border_tiles);
 
             system("cls");
             print_piece_pos_infos(piece);
@@ -139,7 +139,7 @@ char *piece_data_display_test()
         BeginDrawing();
         ClearBackground(BLACK);
         draw_grid();
-        draw_piece(piece, show_missing_connection_tiles, show_border_tiles);
+        draw_piece(piece, piece_drawing_array + piece_idx, show_missing_connection_tiles, show_border_tiles);
         EndDrawing();
     }
     CloseWindow();
@@ -321,7 +321,9 @@ char *board_interactive_display_test()
     LevelHints *level_hints = get_level_hints(level_num);
 
     Board *board = init_board(level_hints);
-    update_board_static_drawing(board);
+    BoardDrawing *board_drawing = init_board_drawing();
+    SolverContext *context = init_solver_context();
+    update_board_static_drawing(board, board_drawing);
 
     // input variables
     int piece_idx = -1;
@@ -341,7 +343,7 @@ char *board_interactive_display_test()
     Piece *piece = (board->piece_array) + piece_idx;
 
     blit_piece_main_data(piece, side_idx, base_pos, rotation_state);
-    update_piece_all_drawing(piece, show_missing_connection_tiles, show_border_tiles);
+    update_piece_all_drawing(piece, (board_drawing->piece_drawing_array) + piece_idx, show_missing_connection_tiles, show_border_tiles);
     // print_controls();
     print_piece_pos_infos(piece);
 
@@ -410,11 +412,13 @@ char *board_interactive_display_test()
             need_level_reset = false;
             try_adding_piece = false;
             free(level_hints);
+            free(board_drawing);
             free(board);
 
             level_hints = get_level_hints(level_num);
             board = init_board(level_hints);
-            update_board_static_drawing(board);
+            board_drawing = init_board_drawing();
+            update_board_static_drawing(board, board_drawing);
 
             // to account for already played pieces (obligatory pieces from level hints)
             piece_idx = -1;
@@ -445,7 +449,7 @@ char *board_interactive_display_test()
                 if (return_val == 1)
                 {
 
-                    return_val = run_all_checks(board, true);
+                    return_val = run_all_checks(board, context, true);
                     print_check_result(return_val);
 
                     if (return_val != 1)
@@ -455,7 +459,7 @@ char *board_interactive_display_test()
                     }
                     else
                     {
-                        update_piece_all_drawing(piece, show_missing_connection_tiles, show_border_tiles);
+                        update_piece_all_drawing(piece, (board_drawing->piece_drawing_array) + piece_idx, show_missing_connection_tiles, show_border_tiles);
                         // move on to next piece automatically only if adding and checks all passed
                         piece_idx = get_next_piece_idx(board, piece_idx);
                         if (piece_idx == -1)
@@ -474,15 +478,15 @@ char *board_interactive_display_test()
                 try_adding_piece = false;
             }
 
-            update_piece_all_drawing(piece, show_missing_connection_tiles, show_border_tiles);
+            update_piece_all_drawing(piece, (board_drawing->piece_drawing_array) + piece_idx, show_missing_connection_tiles, show_border_tiles);
         }
         if (IsKeyPressed(KEY_P))
             printf("pause breakpoint.\n");
 
         BeginDrawing();
         ClearBackground(BLACK);
-        draw_board(board);
-        draw_piece(piece, show_missing_connection_tiles, show_border_tiles);
+        draw_board(board, board_drawing);
+        draw_piece(piece, (board_drawing->piece_drawing_array) + piece_idx, show_missing_connection_tiles, show_border_tiles);
         draw_level_num(level_num);
         if (display_tile_pos)
             draw_pos_text();
@@ -490,6 +494,8 @@ char *board_interactive_display_test()
     }
 
     CloseWindow();
+    free(context);
+    free(board_drawing);
     free(board);
     free(level_hints);
     if (board_complete)
@@ -0,0 +1,228 @@
+/**
+ * @file test_placement.c
+ * Unit testing on placement.c api
+ *
+ * The placement table must give the exact same tile positions and connections as piece.c > "blit_piece_main_data"
+ * The point position index must list every placement of a side with a point exactly once, at the position of its point
+ * And the region shape table (see region_shapes.c) must know which pieces can fill a few well known holes
+ * The level placements of master levels must be built after their pre-added pieces are on the board (see board.c > "init_board")
+ */
+
+#include <local/utils.h>      // Vector2_int, helper functions and defines
+#include <local/piece_data.h> // Piece, load_piece_array
+#include <local/piece.h>      // blit_piece_main_data
+
+#include <local/level_data.h> // LevelHints, get_level_hints
+#include <local/board.h>      // Board, init_board, can_placement_idx_be_added_to_board
+
+#include <local/placement.h>
+#include <local/region_shapes.h>
+#include <minunit.h>
+#include <stdio.h>  // printf, getchar
+#include <stdlib.h> // system, free
+
+int tests_run = 0;
+
+// Returns true if all tiles of the blitted side are inside the board
+static bool is_blit_inside_board(Side *side)
+{
+    for (int tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+        if (!is_pos_inside_board(&(side->tile_array[tile_idx].absolute_pos)))
+            return false;
+    for (int tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+        if (!is_pos_inside_board(&(side->missing_connection_tile_array[tile_idx].absolute_pos)))
+            return false;
+    return true;
+}
+
+// Returns true if the placement data is the same as the live data of the blitted side
+static bool is_placement_matching_blit(const Placement *placement, Side *side)
+{
+    Tile *tile;
+    uint8_t connection_mask;
+
+    for (int tile_idx = 0; tile_idx < side->nb_of_tiles; tile_idx++)
+    {
+        tile = (side->tile_array) + tile_idx;
+        if (placement->tile_bit_idx_array[tile_idx] != POS_TO_BIT_IDX(tile->absolute_pos.i, tile->absolute_pos.j))
+            return false;
+
+        connection_mask = 0;
+        for (int connection_idx = 0; connection_idx < tile->nb_of_connections; connection_idx++)
+            connection_mask |= DIRECTION_TO_MASK(tile->connection_direction_array[connection_idx]);
+        if (placement->tile_connection_mask_array[tile_idx] != connection_mask)
+            return false;
+    }
+
+    for (int tile_idx = 0; tile_idx < side->nb_of_missing_connection_tiles; tile_idx++)
+    {
+        tile = (side->missing_connection_tile_array) + tile_idx;
+        if (placement->missing_connection_tile_bit_idx_array[tile_idx] != POS_TO_BIT_IDX(tile->absolute_pos.i, tile->absolute_pos.j))
+            return false;
+        if (placement->missing_connection_tile_direction_array[tile_idx] != tile->connection_direction_array[0])
+            return false;
+    }
+
+    return true;
+}
+
+char *test_placement_table_against_blit()
+{
+    Piece piece_array[NB_OF_PIECES];
+    load_piece_array(piece_array);
+    load_placement_table();
+
+    Piece *piece;
+    Side *side;
+    Vector2_int base_pos;
+    int placement_idx;
+    int nb_of_checked_placements = 0;
+
+    for (int piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+    {
+        piece = piece_array + piece_idx;
+        for (int side_idx = 0; side_idx < piece->nb_of_sides; side_idx++)
+        {
+            side = (piece->side_array) + side_idx;
+            for (base_pos.i = 0; base_pos.i < BOARD_WIDTH; base_pos.i++)
+            {
+                for (base_pos.j = 0; base_pos.j < BOARD_HEIGHT; base_pos.j++)
+                {
+                    for (int rotation_state = 0; rotation_state < NB_OF_DIRECTIONS; rotation_state++)
+                    {
+                        blit_piece_main_data(piece, side_idx, base_pos, rotation_state);
+                        placement_idx = get_placement_idx(piece_idx, side_idx, base_pos, rotation_state);
+
+                        if (!is_blit_inside_board(side))
+                        {
+                            mu_assert("A blit out of bounds has a placement", placement_idx == UNDEFINED_PLACEMENT_IDX);
+                            continue;
+                        }
+
+                        mu_assert("A blit inside the board has no placement", placement_idx != UNDEFINED_PLACEMENT_IDX);
+                        mu_assert("Placement data doesn't match blit_piece_main_data", is_placement_matching_blit(placement_table.placement_array + placement_idx, side));
+                        nb_of_checked_placements++;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%d placements checked (%d in the table)\n", nb_of_checked_placements, placement_table.nb_of_placements);
+    mu_assert("Placement table has extra placements", nb_of_checked_placements == placement_table.nb_of_placements);
+
+    return 0;
+}
+
+char *test_point_placement_index()
+{
+    load_placement_table();
+
+    int nb_of_point_placements = 0;
+    int bit_idx, piece_idx, k, placement_idx;
+
+    for (placement_idx = 0; placement_idx < placement_table.nb_of_placements; placement_idx++)
+        if (placement_table.placement_array[placement_idx].point_tile_mask)
+            nb_of_point_placements++;
+
+    mu_assert("Point placement index has missing or extra placements", placement_table.first_point_placement_idx_array[BOARD_TOTAL_NB_TILES - 1][NB_OF_PIECES] == nb_of_point_placements);
+
+    for (bit_idx = 0; bit_idx < BOARD_TOTAL_NB_TILES; bit_idx++)
+    {
+        for (piece_idx = 0; piece_idx < NB_OF_PIECES; piece_idx++)
+        {
+            for (k = placement_table.first_point_placement_idx_array[bit_idx][piece_idx]; k < placement_table.first_point_placement_idx_array[bit_idx][piece_idx + 1]; k++)
+            {
+                placement_idx = placement_table.point_placement_idx_array[k];
+                mu_assert("Indexed placement has its point elsewhere", placement_table.placement_array[placement_idx].point_tile_mask == (((uint32_t)1) << bit_idx));
+                mu_assert("Indexed placement belongs to another piece", placement_table.placement_array[placement_idx].piece_idx == piece_idx);
+                if (k > placement_table.first_point_placement_idx_array[bit_idx][piece_idx])
+                    mu_assert("Indexed placements aren't in placement order", placement_table.point_placement_idx_array[k - 1] < placement_idx);
+            }
+        }
+    }
+
+    return 0;
+}
+
+char *test_region_shape_table()
+{
+    load_placement_table();
+
+    // holes in the middle of the board, so that no placement is missing because of the board edges
+    uint32_t bend_hole_mask = POS_TO_BIT_MASK(&((Vector2_int){3, 1})) | POS_TO_BIT_MASK(&((Vector2_int){3, 2})) | POS_TO_BIT_MASK(&((Vector2_int){4, 2}));
+    uint32_t line_hole_mask = POS_TO_BIT_MASK(&((Vector2_int){2, 1})) | POS_TO_BIT_MASK(&((Vector2_int){3, 1})) | POS_TO_BIT_MASK(&((Vector2_int){4, 1}));
+    uint32_t square_hole_mask = POS_TO_BIT_MASK(&((Vector2_int){3, 1})) | POS_TO_BIT_MASK(&((Vector2_int){3, 2})) | POS_TO_BIT_MASK(&((Vector2_int){4, 1})) | POS_TO_BIT_MASK(&((Vector2_int){4, 2}));
+    int all_piece_mask = (1 << NB_OF_PIECES) - 1;
+
+    mu_assert("A hole of 1 tile can be filled", !can_small_region_be_filled(POS_TO_BIT_MASK(&((Vector2_int){3, 1})), all_piece_mask));
+
+    mu_assert("A corner piece can't fill an L-shaped hole", can_small_region_be_filled(bend_hole_mask, 1 << CORNER_1));
+    mu_assert("Line pieces can fill an L-shaped hole", !can_small_region_be_filled(bend_hole_mask, all_piece_mask & ~((1 << CORNER_1) | (1 << CORNER_2))));
+
+    mu_assert("A line piece can't fill a straight hole", can_small_region_be_filled(line_hole_mask, 1 << LINE3_2));
+    mu_assert("Corner pieces can fill a straight hole", !can_small_region_be_filled(line_hole_mask, (1 << CORNER_1) | (1 << CORNER_2)));
+
+    mu_assert("The square piece can't fill a square hole", can_small_region_be_filled(square_hole_mask, 1 << SQUARE));
+    mu_assert("2 line pieces can't fill a square hole", can_small_region_be_filled(square_hole_mask, (1 << LINE2_1) | (1 << LINE2_2)));
+    mu_assert("1 line piece can fill a square hole", !can_small_region_be_filled(square_hole_mask, 1 << LINE2_1));
+
+    return 0;
+}
+
+// Master levels are the only ones with pre-added pieces : they are added by "init_board" before the level placements exist
+char *test_level_placements_of_master_levels()
+{
+    LevelHints *level_hints;
+    Board *first_board, *second_board;
+    int placement_idx;
+
+    for (int level_num = 73; level_num <= 96; level_num++)
+    {
+        level_hints = get_level_hints(level_num);
+        first_board = init_board(level_hints);  // builds the level placements
+        second_board = init_board(level_hints); // shares them
+
+        mu_assert("A pre-added piece of a master level has been rejected", first_board->nb_of_level_pieces == level_hints->nb_of_obligatory_pieces);
+        mu_assert("A pre-added piece of a master level has been rejected by a board that shares the level placements", second_board->nb_of_level_pieces == level_hints->nb_of_obligatory_pieces);
+        mu_assert("The boards of a level don't share their level placements", first_board->level_placements == second_board->level_placements && first_board->level_placements->is_loaded);
+
+        // the shortcut of the level placements must not change what can be added
+        for (int i = 0; i < first_board->level_placements->nb_of_level_placements; i++)
+        {
+            placement_idx = first_board->level_placements->level_placement_idx_array[i];
+            mu_assert("A level placement doesn't fit on the level hints board", can_placement_idx_be_added_to_board(second_board, placement_idx) == 1);
+        }
+
+        free(first_board);
+        free(second_board);
+        free(level_hints);
+    }
+
+    return 0;
+}
+
+char *all_tests()
+{
+    mu_run_test(test_placement_table_against_blit);
+    mu_run_test(test_point_placement_index);
+    mu_run_test(test_region_shape_table);
+    mu_run_test(test_level_placements_of_master_levels);
+    return 0;
+}
+
+int main(void)
+{
+    printf("Press any key to continue testing.\n");
+    getchar();
+    system("cls");
+    char *test_results = all_tests();
+    if (test_results != 0)
+        printf("Error. Test failed. Msg : %s\n", test_results);
+    else
+    {
+        printf("All tests passed! (%d total tests)\n", tests_run);
+    }
+
+    return 0;
+}
@@ -53,10 +53,31 @@ char *test_direction_functions()
     return 0;
 }
 
+char *test_bitboard_macros()
+{
+    Vector2_int pos = {1, 0};
+    uint32_t neighbour_mask;
+
+    // (1,0) -> bit 4, its neighbours are (0,0), (2,0) and (1,1) (no wrap to (0,3))
+    neighbour_mask = NEIGHBOUR_MASK(POS_TO_BIT_MASK(&pos));
+    printf("neighbour mask of {1,0} : 0x%08X\n", neighbour_mask);
+    mu_assert("neighbour mask of {1,0}, should be 0x00000121", (neighbour_mask == 0x00000121));
+
+    // (7,3) -> last bit, its neighbours are (6,3) and (7,2) (no wrap to (0,0))
+    pos.i = BOARD_WIDTH - 1;
+    pos.j = BOARD_HEIGHT - 1;
+    neighbour_mask = NEIGHBOUR_MASK(POS_TO_BIT_MASK(&pos));
+    printf("neighbour mask of {7,3} : 0x%08X\n", neighbour_mask);
+    mu_assert("neighbour mask of {7,3}, should be 0x48000000", (neighbour_mask == 0x48000000));
+
+    return 0;
+}
+
 char *all_tests()
 {
     mu_run_test(test_rotate_pos);
     mu_run_test(test_direction_functions);
+    mu_run_test(test_bitboard_macros);
     return 0;
 }
 